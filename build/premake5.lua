@@ -43,6 +43,18 @@ newoption
     default = "off"
 }
 
+newoption
+{
+    trigger = "profiler",
+    value = "PROFILER",
+    description = "compile the CPU zone profiler (F8 trace dump)",
+    allowed = {
+        { "on", "On"},
+        { "off", "Off"}
+    },
+    default = "on"
+}
+
 function download_progress(total, current)
     local ratio = current / total;
     ratio = math.min(math.max(ratio, 0), 1);
@@ -115,6 +127,58 @@ function platform_defines()
     filter {}
 end
 
+-- Console tool linking the game's sources (minus main.c) plus tools/bench_common.c and one entry file.
+function headless_tool_project(name, mainFile)
+    project (name)
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        files {"../src/**.c", "../src/**.h", "../include/**.h", "../tools/bench_common.c", "../tools/bench_common.h", mainFile}
+        removefiles {"../src/main.c"}
+
+        includedirs { "../src" }
+        includedirs { "../include" }
+        includedirs { "../tools" }
+
+        links {"raylib"}
+
+        cdialect "C17"
+
+        includedirs {raylib_dir .. "/src" }
+
+        platform_defines()
+
+        filter {"options:profiler=on"}
+            defines {"ENABLE_PROFILER"}
+        filter{}
+
+        filter "action:vs*"
+            defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
+            dependson {"raylib"}
+            links {"raylib.lib"}
+            characterset ("Unicode")
+
+        filter "system:windows"
+            defines{"_WIN32"}
+            links {"winmm", "gdi32", "opengl32"}
+            libdirs {"../bin/%{cfg.buildcfg}"}
+
+        filter "system:linux"
+            links {"pthread", "m", "dl", "rt"}
+
+        filter {"system:linux", "options:wayland=off"}
+            links {"X11"}
+
+        filter {"system:linux", "options:wayland=on"}
+            links {"wayland-client", "wayland-cursor", "wayland-egl", "xkbcommon"}
+
+        filter "system:macosx"
+            links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
+
+        filter{}
+end
+
 -- if you don't want to download raylib, then set this to false, and set the raylib dir to where you want raylib to be pulled from, must be full sources.
 downloadRaylib = true
 raylib_dir = "external/raylib-master"
@@ -215,6 +279,10 @@ if (downloadRaylib) then
         flags { "ShadowedVariables"}
         platform_defines()
 
+        filter {"options:profiler=on"}
+            defines {"ENABLE_PROFILER"}
+        filter{}
+
         filter "action:vs*"
             defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
             dependson {"raylib"}
@@ -240,7 +308,15 @@ if (downloadRaylib) then
             links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
 
         filter{}
-        
+
+
+    -- Headless simulation / benchmark harness: the game's simulation code without main.c,
+    -- driven by tools/headless_sim.c. Never opens a window, so it runs on boxes with no GPU.
+    headless_tool_project("headless_sim", "../tools/headless_sim.c")
+
+    -- Map micro-benchmarks (tools/map_bench.c): same headless setup as headless_sim.
+    headless_tool_project("map_bench", "../tools/map_bench.c")
+
 
     project "raylib"
         kind "StaticLib"
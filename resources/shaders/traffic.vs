@@ -0,0 +1,43 @@
+#version 330
+
+// Input vertex attributes
+in vec3 vertexPosition;
+in vec3 vertexNormal;
+in vec4 vertexColor;        // r = part id (TRAFFIC_PART_* in traffic.c)
+
+// Input instance attributes (one entry per car)
+in mat4 instanceTransform;
+in vec4 instanceColor;      // rgb = paint, a = brake lights on
+
+// Input uniforms
+uniform mat4 mvp;
+
+// Output to Fragment Shader
+out vec4 fragColor;
+
+void main()
+{
+    // 1. Pick the part color
+    int part = int(vertexColor.r * 255.0 + 0.5);
+    vec4 color = vec4(instanceColor.rgb, 1.0);
+    float emissive = 0.0;
+
+    if (part == 1) color.a = 0.8;                                   // Cabin
+    else if (part == 2) color = vec4(0.39, 0.71, 1.0, 0.71);        // Windshield
+    else if (part == 3 && instanceColor.a > 0.5) {                  // Brake lights (off = paint)
+        color = vec4(0.9, 0.16, 0.22, 1.0);
+        emissive = 1.0;
+    }
+    else if (part == 4) {                                           // Headlights
+        color = vec4(0.96, 0.96, 0.96, 1.0);
+        emissive = 1.0;
+    }
+
+    // 2. Cheap face shading so the box edges stay readable
+    vec3 normal = normalize(mat3(instanceTransform) * vertexNormal);
+    float shade = 0.75 + 0.25 * max(dot(normal, normalize(vec3(0.3, 1.0, 0.5))), 0.0);
+    fragColor = vec4(color.rgb * mix(shade, 1.0, emissive), color.a);
+
+    // 3. Final Clip Position
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
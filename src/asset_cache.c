@@ -0,0 +1,1097 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#include "asset_cache.h"
+#include "thread_pool.h"
+#include "raymath.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// --- CONSTANTS ---
+#define MESH_CACHE_DIR "cache"
+#define MESH_CACHE_MAGIC 0x434D4744u   // "DGMC"
+#define MESH_CACHE_VERSION 2u             // 2: .mtl stamps in the header
+#define MAX_ASSET_MATERIALS 16          // Unique materials (= meshes) per model
+#define MAX_OBJ_MATERIALS 64            // Raw newmtl entries per .mtl
+#define MAX_FACE_VERTS 64
+#define MAX_MTL_LIBS 4                  // mtllib lines per .obj tracked for cache invalidation
+#define MAX_SHARED_TEXTURES 32
+#define ASSET_PATH_LEN 192
+#define MAX_REGISTRY_ENTRIES 48         // Showroom props + base/upgrade per car (24) and the menu diorama (3), with headroom
+#define MAX_DECODE_JOBS 3               // Helper threads per DecodeModelBatch, besides the caller
+
+typedef struct CpuMaterial {
+    Color diffuse;
+    char texturePath[ASSET_PATH_LEN];   // Resolved path, empty if untextured
+} CpuMaterial;
+
+// A model decoded on a worker thread, waiting for its GPU upload
+typedef struct CpuModel {
+    char path[ASSET_PATH_LEN];
+    Mesh meshes[MAX_ASSET_MATERIALS];   // One non-indexed mesh per unique material
+    int meshMaterial[MAX_ASSET_MATERIALS];
+    int meshCount;
+    CpuMaterial materials[MAX_ASSET_MATERIALS];
+    int materialCount;
+    char mtlPaths[MAX_MTL_LIBS][ASSET_PATH_LEN];   // .mtl files the materials came from (cache stamp)
+    int mtlCount;
+    bool fromCache;
+} CpuModel;
+
+typedef struct SharedTexture {
+    char path[ASSET_PATH_LEN];
+    Texture2D texture;
+} SharedTexture;
+
+typedef struct PendingTexture {
+    char path[ASSET_PATH_LEN];
+    Image image;
+} PendingTexture;
+
+// A batch decoded off the main thread (DecodeModelBatch), waiting for UploadModelBatch
+struct ModelBatch {
+    CpuModel *models;
+    int count;
+    PendingTexture *textures;           // Every texture the batch uses, resident or not
+    int textureCount;
+};
+
+// One helper thread's share of a DecodeModelBatch
+typedef struct DecodeSlice {
+    CpuModel *models;
+    int start;
+    int end;
+} DecodeSlice;
+
+// A reference-counted model owned by the registry
+typedef struct RegistryEntry {
+    char path[ASSET_PATH_LEN];
+    int refCount;
+    bool resident;          // Uploaded (model may be empty if the load failed)
+    Model model;
+    CpuModel *decoded;      // Prefetched mesh data waiting for upload
+    bool queued;            // Being loaded by the current AcquireModels call (not recyclable)
+} RegistryEntry;
+
+typedef struct FloatList {
+    float *data;
+    int count;
+    int capacity;
+} FloatList;
+
+typedef struct ObjMaterial {
+    char name[64];
+    int unique;     // Index into CpuModel.materials
+} ObjMaterial;
+
+// --- STATE ---
+static SharedTexture sharedTextures[MAX_SHARED_TEXTURES];
+static int sharedTextureCount = 0;
+
+static RegistryEntry registry[MAX_REGISTRY_ENTRIES];
+static int registryCount = 0;
+
+// In-flight background prefetch (worker owns prefetchModels until the job is done)
+static BackgroundJob *prefetchJob = NULL;
+static CpuModel *prefetchModels = NULL;
+static int prefetchCount = 0;
+
+// --- HELPER FUNCTIONS ---
+
+static void PushFloats(FloatList *list, const float *values, int n) {
+    if (list->count + n > list->capacity) {
+        int newCap = (list->capacity == 0) ? 1024 : list->capacity * 2;
+        while (newCap < list->count + n) newCap *= 2;
+        float *grown = (float *)realloc(list->data, newCap * sizeof(float));
+        if (!grown) return;
+        list->data = grown;
+        list->capacity = newCap;
+    }
+    memcpy(list->data + list->count, values, n * sizeof(float));
+    list->count += n;
+}
+
+static void FreeCpuModel(CpuModel *model) {
+    for (int i = 0; i < model->meshCount; i++) {
+        MemFree(model->meshes[i].vertices);
+        MemFree(model->meshes[i].texcoords);
+        MemFree(model->meshes[i].normals);
+    }
+    model->meshCount = 0;
+}
+
+/*
+ * Description: Copies a string with trailing whitespace (CR, LF, spaces) removed.
+ * Parameters:
+ * - dst: Output buffer.
+ * - size: Output buffer size.
+ * - src: Source text.
+ * Returns: None.
+ */
+static void CopyTrimmed(char *dst, int size, const char *src) {
+    while (*src == ' ' || *src == '\t') src++;
+    snprintf(dst, size, "%s", src);
+    int len = (int)strlen(dst);
+    while (len > 0 && (dst[len - 1] == '\r' || dst[len - 1] == '\n' || dst[len - 1] == ' ' || dst[len - 1] == '\t')) dst[--len] = '\0';
+}
+
+/*
+ * Description: Joins a directory and a relative file name, converting backslashes (Blender on Windows writes them).
+ * Parameters:
+ * - dst: Output buffer (ASSET_PATH_LEN).
+ * - dir: Directory with trailing separator, or empty.
+ * - name: Relative file name.
+ * Returns: None.
+ */
+static void JoinAssetPath(char *dst, const char *dir, const char *name) {
+    snprintf(dst, ASSET_PATH_LEN, "%s%s", dir, name);
+    for (char *c = dst; *c; c++) if (*c == '\\') *c = '/';
+}
+
+/*
+ * Description: Reads a whole file into a null-terminated buffer (worker-thread safe, no raylib logging).
+ * Parameters:
+ * - path: File to read.
+ * Returns: malloc'd buffer, or NULL on failure.
+ */
+static char *ReadTextFile(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char *text = (size >= 0) ? (char *)malloc(size + 1) : NULL;
+    if (text) {
+        size_t got = fread(text, 1, size, f);
+        text[got] = '\0';
+    }
+    fclose(f);
+    return text;
+}
+
+/*
+ * Description: Returns the index of a material in the model's unique list, adding it if new.
+ *              Blender exports one newmtl per object even when they are identical, so duplicates merge.
+ * Parameters:
+ * - model: Model being decoded.
+ * - mat: Material to find or add.
+ * Returns: Unique material index.
+ */
+static int AddUniqueMaterial(CpuModel *model, CpuMaterial mat) {
+    for (int i = 0; i < model->materialCount; i++) {
+        CpuMaterial *m = &model->materials[i];
+        if (m->diffuse.r == mat.diffuse.r && m->diffuse.g == mat.diffuse.g && m->diffuse.b == mat.diffuse.b &&
+            m->diffuse.a == mat.diffuse.a && strcmp(m->texturePath, mat.texturePath) == 0) return i;
+    }
+    if (model->materialCount >= MAX_ASSET_MATERIALS) return 0;
+    model->materials[model->materialCount] = mat;
+    return model->materialCount++;
+}
+
+/*
+ * Description: Parses the newmtl / Kd / map_Kd entries of a .mtl file.
+ * Parameters:
+ * - model: Model being decoded (receives unique materials).
+ * - mtlPath: Path to the .mtl file.
+ * - baseDir: Directory texture paths are relative to.
+ * - raw: Receives the named materials.
+ * - rawCount: In/out count of named materials.
+ * Returns: None.
+ */
+static void ParseMtlFile(CpuModel *model, const char *mtlPath, const char *baseDir, ObjMaterial *raw, int *rawCount) {
+    char *text = ReadTextFile(mtlPath);
+    if (!text) return;
+
+    CpuMaterial current = { WHITE, "" };
+    int open = -1; // Raw index of the material being read
+
+    char *line = text;
+    while (line && *line) {
+        char *next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+        while (*line == ' ' || *line == '\t') line++;
+
+        if (strncmp(line, "newmtl ", 7) == 0) {
+            if (open >= 0) raw[open].unique = AddUniqueMaterial(model, current);
+            open = -1;
+            if (*rawCount < MAX_OBJ_MATERIALS) {
+                open = (*rawCount)++;
+                CopyTrimmed(raw[open].name, sizeof(raw[open].name), line + 7);
+                raw[open].unique = 0;
+            }
+            current = (CpuMaterial){ WHITE, "" };
+        }
+        else if (strncmp(line, "Kd ", 3) == 0) {
+            char *p = line + 3;
+            float r = strtof(p, &p), g = strtof(p, &p), b = strtof(p, &p);
+            current.diffuse = (Color){ (unsigned char)(Clamp(r, 0.0f, 1.0f) * 255.0f), (unsigned char)(Clamp(g, 0.0f, 1.0f) * 255.0f),
+                                       (unsigned char)(Clamp(b, 0.0f, 1.0f) * 255.0f), 255 };
+        }
+        else if (strncmp(line, "map_Kd ", 7) == 0) {
+            char name[ASSET_PATH_LEN];
+            CopyTrimmed(name, sizeof(name), line + 7);
+            JoinAssetPath(current.texturePath, baseDir, name);
+        }
+        line = next;
+    }
+    if (open >= 0) raw[open].unique = AddUniqueMaterial(model, current);
+
+    free(text);
+}
+
+/*
+ * Description: Parses a Wavefront OBJ into one non-indexed mesh per unique material. Polygons are
+ *              fan-triangulated, V is flipped like raylib's loader, and missing normals get the face normal.
+ * Parameters:
+ * - model: Model to fill (path set by the caller).
+ * Returns: True if at least one triangle was read.
+ */
+static bool ParseObjFile(CpuModel *model) {
+    char *text = ReadTextFile(model->path);
+    if (!text) return false;
+
+    char baseDir[ASSET_PATH_LEN] = { 0 };
+    snprintf(baseDir, sizeof(baseDir), "%s", model->path);
+    char *slash = strrchr(baseDir, '/');
+    char *backslash = strrchr(baseDir, '\\');
+    if (backslash > slash) slash = backslash;
+    if (slash) slash[1] = '\0'; else baseDir[0] = '\0';
+
+    FloatList positions = { 0 }, texcoords = { 0 }, normals = { 0 };
+    FloatList groupPos[MAX_ASSET_MATERIALS] = { 0 };
+    FloatList groupUv[MAX_ASSET_MATERIALS] = { 0 };
+    FloatList groupNrm[MAX_ASSET_MATERIALS] = { 0 };
+    ObjMaterial *raw = (ObjMaterial *)calloc(MAX_OBJ_MATERIALS, sizeof(ObjMaterial));
+    int rawCount = 0;
+    int current = -1;
+
+    char *line = text;
+    while (line && *line) {
+        char *next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+        while (*line == ' ' || *line == '\t') line++;
+
+        if (line[0] == 'v' && line[1] == ' ') {
+            char *p = line + 2;
+            float v[3] = { strtof(p, &p), strtof(p, &p), strtof(p, &p) };
+            PushFloats(&positions, v, 3);
+        }
+        else if (line[0] == 'v' && line[1] == 't' && line[2] == ' ') {
+            char *p = line + 3;
+            float v[2] = { strtof(p, &p), strtof(p, &p) };
+            PushFloats(&texcoords, v, 2);
+        }
+        else if (line[0] == 'v' && line[1] == 'n' && line[2] == ' ') {
+            char *p = line + 3;
+            float v[3] = { strtof(p, &p), strtof(p, &p), strtof(p, &p) };
+            PushFloats(&normals, v, 3);
+        }
+        else if (strncmp(line, "mtllib ", 7) == 0 && raw) {
+            char name[ASSET_PATH_LEN], mtlPath[ASSET_PATH_LEN];
+            CopyTrimmed(name, sizeof(name), line + 7);
+            JoinAssetPath(mtlPath, baseDir, name);
+            if (model->mtlCount < MAX_MTL_LIBS) snprintf(model->mtlPaths[model->mtlCount++], ASSET_PATH_LEN, "%s", mtlPath);
+            ParseMtlFile(model, mtlPath, baseDir, raw, &rawCount);
+        }
+        else if (strncmp(line, "usemtl ", 7) == 0) {
+            char name[64];
+            CopyTrimmed(name, sizeof(name), line + 7);
+            current = -1;
+            for (int i = 0; i < rawCount; i++) {
+                if (strcmp(raw[i].name, name) == 0) { current = raw[i].unique; break; }
+            }
+        }
+        else if (line[0] == 'f' && line[1] == ' ') {
+            int vi[MAX_FACE_VERTS], ti[MAX_FACE_VERTS], ni[MAX_FACE_VERTS];
+            int n = 0;
+            int posCount = positions.count / 3, uvCount = texcoords.count / 2, nrmCount = normals.count / 3;
+            bool valid = true;
+
+            char *p = line + 2;
+            while (*p && n < MAX_FACE_VERTS) {
+                while (*p == ' ' || *p == '\t' || *p == '\r') p++;
+                if (*p == '\0') break;
+
+                char *end;
+                long v = strtol(p, &end, 10);
+                if (end == p) break;
+                p = end;
+                long t = 0, nn = 0;
+                if (*p == '/') {
+                    p++;
+                    if (*p != '/') { t = strtol(p, &end, 10); p = end; }
+                    if (*p == '/') { p++; nn = strtol(p, &end, 10); p = end; }
+                }
+
+                // OBJ indices are 1-based, negative ones count back from the end
+                vi[n] = (v > 0) ? (int)v - 1 : posCount + (int)v;
+                ti[n] = (t > 0) ? (int)t - 1 : (t < 0 ? uvCount + (int)t : -1);
+                ni[n] = (nn > 0) ? (int)nn - 1 : (nn < 0 ? nrmCount + (int)nn : -1);
+                if (vi[n] < 0 || vi[n] >= posCount) valid = false;
+                if (ti[n] >= uvCount) ti[n] = -1;
+                if (ni[n] >= nrmCount) ni[n] = -1;
+                n++;
+            }
+            if (!valid || n < 3) { line = next; continue; }
+
+            if (current < 0) current = AddUniqueMaterial(model, (CpuMaterial){ WHITE, "" });
+            int g = current;
+
+            for (int k = 1; k + 1 < n; k++) {
+                int corner[3] = { 0, k, k + 1 };
+
+                Vector3 p0 = { positions.data[vi[0]*3], positions.data[vi[0]*3+1], positions.data[vi[0]*3+2] };
+                Vector3 p1 = { positions.data[vi[k]*3], positions.data[vi[k]*3+1], positions.data[vi[k]*3+2] };
+                Vector3 p2 = { positions.data[vi[k+1]*3], positions.data[vi[k+1]*3+1], positions.data[vi[k+1]*3+2] };
+                Vector3 faceNormal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0)));
+
+                for (int c = 0; c < 3; c++) {
+                    int idx = corner[c];
+                    PushFloats(&groupPos[g], &positions.data[vi[idx]*3], 3);
+
+                    float uv[2] = { 0.0f, 0.0f };
+                    if (ti[idx] >= 0) {
+                        uv[0] = texcoords.data[ti[idx]*2];
+                        uv[1] = 1.0f - texcoords.data[ti[idx]*2 + 1];
+                    }
+                    PushFloats(&groupUv[g], uv, 2);
+
+                    if (ni[idx] >= 0) PushFloats(&groupNrm[g], &normals.data[ni[idx]*3], 3);
+                    else PushFloats(&groupNrm[g], (float *)&faceNormal, 3);
+                }
+            }
+        }
+        line = next;
+    }
+
+    // Build one mesh per material group, in order of first use
+    for (int g = 0; g < MAX_ASSET_MATERIALS; g++) {
+        int vertexCount = groupPos[g].count / 3;
+        if (vertexCount >= 3 && groupUv[g].count == vertexCount * 2 && groupNrm[g].count == vertexCount * 3) {
+            Mesh mesh = { 0 };
+            mesh.vertexCount = vertexCount;
+            mesh.triangleCount = vertexCount / 3;
+            mesh.vertices = (float *)MemAlloc(vertexCount * 3 * sizeof(float));
+            mesh.texcoords = (float *)MemAlloc(vertexCount * 2 * sizeof(float));
+            mesh.normals = (float *)MemAlloc(vertexCount * 3 * sizeof(float));
+            memcpy(mesh.vertices, groupPos[g].data, vertexCount * 3 * sizeof(float));
+            memcpy(mesh.texcoords, groupUv[g].data, vertexCount * 2 * sizeof(float));
+            memcpy(mesh.normals, groupNrm[g].data, vertexCount * 3 * sizeof(float));
+
+            model->meshMaterial[model->meshCount] = g;
+            model->meshes[model->meshCount++] = mesh;
+        }
+        free(groupPos[g].data);
+        free(groupUv[g].data);
+        free(groupNrm[g].data);
+    }
+
+    free(positions.data);
+    free(texcoords.data);
+    free(normals.data);
+    free(raw);
+    free(text);
+    return model->meshCount > 0;
+}
+
+/*
+ * Description: Maps a source path to its cache file (cache/<path with separators flattened>.mesh).
+ * Parameters:
+ * - dst: Output buffer (ASSET_PATH_LEN).
+ * - path: Source .obj path.
+ * Returns: None.
+ */
+static void BuildCachePath(char *dst, const char *path) {
+    snprintf(dst, ASSET_PATH_LEN, "%s/%s.mesh", MESH_CACHE_DIR, path);
+    for (char *c = dst + strlen(MESH_CACHE_DIR) + 1; *c; c++) {
+        if (*c == '/' || *c == '\\' || *c == ':') *c = '_';
+    }
+}
+
+/*
+ * Description: Writes a decoded model to the binary cache. The file is written to <cachePath>.tmp and
+ *              only replaces the cache entry once every write succeeded, so a crash or a full disk never
+ *              leaves a truncated entry behind.
+ * Parameters:
+ * - model: Decoded model.
+ * - cachePath: Output file.
+ * - srcTime: Modification time of the source .obj (stale check).
+ * Returns: None.
+ */
+static void WriteMeshCache(const CpuModel *model, const char *cachePath, long srcTime) {
+    char tempPath[ASSET_PATH_LEN + 4];
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", cachePath);
+
+    FILE *f = fopen(tempPath, "wb");
+    if (!f) return;
+
+    uint32_t header[2] = { MESH_CACHE_MAGIC, MESH_CACHE_VERSION };
+    int64_t stamp = srcTime;
+    int32_t counts[3] = { model->materialCount, model->meshCount, model->mtlCount };
+    bool ok = fwrite(header, sizeof(uint32_t), 2, f) == 2 &&
+              fwrite(&stamp, sizeof(int64_t), 1, f) == 1 &&
+              fwrite(counts, sizeof(int32_t), 3, f) == 3;
+
+    // Materials come from the .mtl files, so their time and size are part of the stamp too
+    for (int i = 0; ok && i < model->mtlCount; i++) {
+        int64_t mtlStamp[2] = { GetFileModTime(model->mtlPaths[i]), GetFileLength(model->mtlPaths[i]) };
+        ok = fwrite(model->mtlPaths[i], 1, ASSET_PATH_LEN, f) == ASSET_PATH_LEN &&
+             fwrite(mtlStamp, sizeof(int64_t), 2, f) == 2;
+    }
+    for (int i = 0; ok && i < model->materialCount; i++) {
+        ok = fwrite(&model->materials[i].diffuse, sizeof(Color), 1, f) == 1 &&
+             fwrite(model->materials[i].texturePath, 1, ASSET_PATH_LEN, f) == ASSET_PATH_LEN;
+    }
+    for (int i = 0; ok && i < model->meshCount; i++) {
+        const Mesh *m = &model->meshes[i];
+        int32_t info[2] = { model->meshMaterial[i], m->vertexCount };
+        ok = fwrite(info, sizeof(int32_t), 2, f) == 2 &&
+             fwrite(m->vertices, sizeof(float), m->vertexCount * 3, f) == (size_t)(m->vertexCount * 3) &&
+             fwrite(m->texcoords, sizeof(float), m->vertexCount * 2, f) == (size_t)(m->vertexCount * 2) &&
+             fwrite(m->normals, sizeof(float), m->vertexCount * 3, f) == (size_t)(m->vertexCount * 3);
+    }
+
+    ok = SyncFileToDisk(f) && ok;
+    fclose(f);
+
+    if (!ok || !ReplaceFileAtomic(tempPath, cachePath)) {
+        printf("ASSETS: Could not write mesh cache %s\n", cachePath);
+        remove(tempPath);
+    }
+}
+
+/*
+ * Description: Reads a model from the binary cache if it exists and matches the source timestamp.
+ * Parameters:
+ * - model: Model to fill.
+ * - cachePath: Cache file.
+ * - srcTime: Modification time of the source .obj.
+ * Returns: True on a valid cache hit (the .obj and every .mtl unchanged).
+ */
+static bool ReadMeshCache(CpuModel *model, const char *cachePath, long srcTime) {
+    FILE *f = fopen(cachePath, "rb");
+    if (!f) return false;
+
+    uint32_t header[2] = { 0 };
+    int64_t stamp = 0;
+    int32_t counts[3] = { 0 };
+    bool ok = fread(header, sizeof(uint32_t), 2, f) == 2 && header[0] == MESH_CACHE_MAGIC && header[1] == MESH_CACHE_VERSION &&
+              fread(&stamp, sizeof(int64_t), 1, f) == 1 && stamp == (int64_t)srcTime &&
+              fread(counts, sizeof(int32_t), 3, f) == 3 &&
+              counts[0] >= 0 && counts[0] <= MAX_ASSET_MATERIALS && counts[1] > 0 && counts[1] <= MAX_ASSET_MATERIALS &&
+              counts[2] >= 0 && counts[2] <= MAX_MTL_LIBS;
+
+    for (int i = 0; ok && i < counts[2]; i++) {
+        char mtlPath[ASSET_PATH_LEN];
+        int64_t mtlStamp[2] = { 0 };
+        ok = fread(mtlPath, 1, ASSET_PATH_LEN, f) == ASSET_PATH_LEN && fread(mtlStamp, sizeof(int64_t), 2, f) == 2;
+        if (!ok) break;
+        mtlPath[ASSET_PATH_LEN - 1] = '\0';
+        ok = mtlStamp[0] == (int64_t)GetFileModTime(mtlPath) && mtlStamp[1] == (int64_t)GetFileLength(mtlPath);
+        if (ok) snprintf(model->mtlPaths[model->mtlCount++], ASSET_PATH_LEN, "%s", mtlPath);
+    }
+
+    for (int i = 0; ok && i < counts[0]; i++) {
+        CpuMaterial *mat = &model->materials[i];
+        ok = fread(&mat->diffuse, sizeof(Color), 1, f) == 1 && fread(mat->texturePath, 1, ASSET_PATH_LEN, f) == ASSET_PATH_LEN;
+        mat->texturePath[ASSET_PATH_LEN - 1] = '\0';
+    }
+    if (ok) model->materialCount = counts[0];
+
+    for (int i = 0; ok && i < counts[1]; i++) {
+        int32_t info[2] = { 0 };
+        ok = fread(info, sizeof(int32_t), 2, f) == 2 && info[0] >= 0 && info[0] < counts[0] && info[1] > 0;
+        if (!ok) break;
+
+        Mesh mesh = { 0 };
+        mesh.vertexCount = info[1];
+        mesh.triangleCount = info[1] / 3;
+        mesh.vertices = (float *)MemAlloc(info[1] * 3 * sizeof(float));
+        mesh.texcoords = (float *)MemAlloc(info[1] * 2 * sizeof(float));
+        mesh.normals = (float *)MemAlloc(info[1] * 3 * sizeof(float));
+        model->meshMaterial[model->meshCount] = info[0];
+        model->meshes[model->meshCount++] = mesh;
+
+        ok = fread(mesh.vertices, sizeof(float), info[1] * 3, f) == (size_t)(info[1] * 3) &&
+             fread(mesh.texcoords, sizeof(float), info[1] * 2, f) == (size_t)(info[1] * 2) &&
+             fread(mesh.normals, sizeof(float), info[1] * 3, f) == (size_t)(info[1] * 3);
+    }
+    fclose(f);
+
+    if (!ok) {
+        FreeCpuModel(model);
+        model->materialCount = 0;
+        model->mtlCount = 0;
+    }
+    return ok;
+}
+
+/*
+ * Description: ParallelFor task: decodes models from the cache, or parses the OBJ and refreshes the cache.
+ * Parameters:
+ * - context: CpuModel array.
+ * - start, end: Range of models to decode.
+ * Returns: None.
+ */
+static void DecodeModelTask(void *context, int start, int end) {
+    CpuModel *models = (CpuModel *)context;
+
+    for (int i = start; i < end; i++) {
+        CpuModel *model = &models[i];
+        if (model->meshCount > 0 || !FileExists(model->path)) continue;
+
+        long srcTime = GetFileModTime(model->path);
+        char cachePath[ASSET_PATH_LEN];
+        BuildCachePath(cachePath, model->path);
+
+        if (ReadMeshCache(model, cachePath, srcTime)) {
+            model->fromCache = true;
+        } else if (ParseObjFile(model)) {
+            WriteMeshCache(model, cachePath, srcTime);
+        }
+    }
+}
+
+/*
+ * Description: ParallelFor task: decodes texture images (file read + PNG decode).
+ * Parameters:
+ * - context: PendingTexture array.
+ * - start, end: Range of textures to decode.
+ * Returns: None.
+ */
+static void DecodeTextureTask(void *context, int start, int end) {
+    PendingTexture *pending = (PendingTexture *)context;
+    for (int i = start; i < end; i++) {
+        if (FileExists(pending[i].path)) pending[i].image = LoadImage(pending[i].path);
+    }
+}
+
+static int FindSharedTexture(const char *path) {
+    for (int i = 0; i < sharedTextureCount; i++) {
+        if (strcmp(sharedTextures[i].path, path) == 0) return i;
+    }
+    return -1;
+}
+
+/*
+ * Description: Uploads a decoded model to the GPU (main thread only). Mesh buffers move into the Model.
+ * Parameters:
+ * - cpu: Decoded model.
+ * Returns: The Model, or an empty Model (meshCount == 0) if decoding failed.
+ */
+static Model UploadCpuModel(CpuModel *cpu) {
+    Model model = { 0 };
+    if (cpu->meshCount == 0) {
+        printf("ASSETS: Failed to load %s\n", cpu->path);
+        return model;
+    }
+
+    model.transform = MatrixIdentity();
+    model.meshCount = cpu->meshCount;
+    model.meshes = (Mesh *)MemAlloc(sizeof(Mesh) * cpu->meshCount);
+    model.meshMaterial = (int *)MemAlloc(sizeof(int) * cpu->meshCount);
+    for (int i = 0; i < cpu->meshCount; i++) {
+        model.meshes[i] = cpu->meshes[i];
+        UploadMesh(&model.meshes[i], false);
+        model.meshMaterial[i] = cpu->meshMaterial[i];
+    }
+
+    model.materialCount = cpu->materialCount;
+    model.materials = (Material *)MemAlloc(sizeof(Material) * cpu->materialCount);
+    for (int i = 0; i < cpu->materialCount; i++) {
+        model.materials[i] = LoadMaterialDefault();
+        model.materials[i].maps[MATERIAL_MAP_DIFFUSE].color = cpu->materials[i].diffuse;
+
+        int tex = (cpu->materials[i].texturePath[0] != '\0') ? FindSharedTexture(cpu->materials[i].texturePath) : -1;
+        if (tex >= 0 && sharedTextures[tex].texture.id != 0) {
+            model.materials[i].maps[MATERIAL_MAP_DIFFUSE].texture = sharedTextures[tex].texture;
+        }
+    }
+    return model;
+}
+
+/*
+ * Description: Lists the textures a batch of decoded models references, once each.
+ * Parameters:
+ * - models: Decoded models.
+ * - count: Number of models.
+ * - pending: Receives the texture paths (MAX_SHARED_TEXTURES entries).
+ * - skipResident: Leave out textures that are already uploaded. Main thread only: a background
+ *   decode cannot read sharedTextures, UploadPendingTextures drops its duplicates instead.
+ * Returns: Number of textures written to pending.
+ */
+static int CollectPendingTextures(const CpuModel *models, int count, PendingTexture *pending, bool skipResident) {
+    int pendingCount = 0;
+    for (int i = 0; i < count; i++) {
+        for (int m = 0; m < models[i].materialCount; m++) {
+            const char *texPath = models[i].materials[m].texturePath;
+            if (texPath[0] == '\0' || (skipResident && FindSharedTexture(texPath) >= 0)) continue;
+
+            bool queued = false;
+            for (int p = 0; p < pendingCount; p++) if (strcmp(pending[p].path, texPath) == 0) queued = true;
+            int limit = skipResident ? MAX_SHARED_TEXTURES - sharedTextureCount : MAX_SHARED_TEXTURES;
+            if (!queued && pendingCount < limit) {
+                snprintf(pending[pendingCount++].path, ASSET_PATH_LEN, "%s", texPath);
+            }
+        }
+    }
+    return pendingCount;
+}
+
+/*
+ * Description: Uploads decoded texture images into the shared texture table (main thread only).
+ *              Textures that became resident in the meantime are skipped. Frees every image.
+ * Parameters:
+ * - pending: Decoded images.
+ * - pendingCount: Number of entries.
+ * Returns: None.
+ */
+static void UploadPendingTextures(PendingTexture *pending, int pendingCount) {
+    for (int p = 0; p < pendingCount; p++) {
+        if (FindSharedTexture(pending[p].path) >= 0 || sharedTextureCount >= MAX_SHARED_TEXTURES) {
+            if (pending[p].image.data) UnloadImage(pending[p].image);
+            continue;
+        }
+
+        SharedTexture *shared = &sharedTextures[sharedTextureCount++];
+        snprintf(shared->path, ASSET_PATH_LEN, "%s", pending[p].path);
+        shared->texture = (Texture2D){ 0 };
+        if (pending[p].image.data) {
+            shared->texture = LoadTextureFromImage(pending[p].image);
+            UnloadImage(pending[p].image);
+        }
+    }
+}
+
+/*
+ * Description: Uploads decoded models whose textures are already resident (main thread only).
+ * Parameters:
+ * - models: Decoded models. Mesh buffers move into outModels.
+ * - outModels: Receives one Model per entry.
+ * - count: Number of models.
+ * Returns: Number of models that came from the binary cache.
+ */
+static int UploadDecodedModels(CpuModel *models, Model *outModels, int count) {
+    int fromCache = 0;
+    for (int i = 0; i < count; i++) {
+        outModels[i] = UploadCpuModel(&models[i]);
+        if (models[i].fromCache) fromCache++;
+    }
+    return fromCache;
+}
+
+/*
+ * Description: Decodes any textures the batch needs that are not resident yet (thread pool), then
+ *              uploads textures and meshes on the calling (main) thread.
+ * Parameters:
+ * - models: Decoded models. Mesh buffers move into outModels.
+ * - outModels: Receives one Model per entry.
+ * - count: Number of models.
+ * Returns: Number of models that came from the binary cache.
+ */
+static int UploadCpuModels(CpuModel *models, Model *outModels, int count) {
+    PendingTexture *pending = (PendingTexture *)calloc(MAX_SHARED_TEXTURES, sizeof(PendingTexture));
+    if (pending) {
+        int pendingCount = CollectPendingTextures(models, count, pending, true);
+        ParallelFor(pendingCount, 1, DecodeTextureTask, pending);
+        UploadPendingTextures(pending, pendingCount);
+        free(pending);
+    }
+    return UploadDecodedModels(models, outModels, count);
+}
+
+/*
+ * Description: Background job: decodes one slice of a DecodeModelBatch.
+ * Parameters:
+ * - context: DecodeSlice.
+ * Returns: None.
+ */
+static void DecodeSliceTask(void *context) {
+    DecodeSlice *slice = (DecodeSlice *)context;
+    DecodeModelTask(slice->models, slice->start, slice->end);
+}
+
+static RegistryEntry *FindRegistryEntry(const char *path) {
+    for (int i = 0; i < registryCount; i++) {
+        if (strcmp(registry[i].path, path) == 0) return &registry[i];
+    }
+    return NULL;
+}
+
+/*
+ * Description: Background job: decodes the prefetch batch (cache read or OBJ parse).
+ * Parameters:
+ * - context: Unused, the batch lives in prefetchModels.
+ * Returns: None.
+ */
+static void PrefetchTask(void *context) {
+    (void)context;
+    DecodeModelTask(prefetchModels, 0, prefetchCount);
+}
+
+/*
+ * Description: Hands a finished prefetch batch to the registry entries.
+ * Parameters:
+ * - wait: Block until the job is done instead of returning if it is still running.
+ * Returns: None.
+ */
+static void CollectPrefetch(bool wait) {
+    if (!prefetchJob) return;
+    if (!wait && !IsBackgroundJobDone(prefetchJob)) return;
+
+    FinishBackgroundJob(prefetchJob);
+    prefetchJob = NULL;
+
+    for (int i = 0; i < prefetchCount; i++) {
+        CpuModel *model = &prefetchModels[i];
+        RegistryEntry *entry = FindRegistryEntry(model->path);
+
+        // Acquired (or discarded) while the job ran
+        if (!entry || entry->resident || entry->decoded) { FreeCpuModel(model); continue; }
+
+        entry->decoded = (CpuModel *)malloc(sizeof(CpuModel));
+        if (entry->decoded) *entry->decoded = *model;
+        else FreeCpuModel(model);
+    }
+    free(prefetchModels);
+    prefetchModels = NULL;
+    prefetchCount = 0;
+}
+
+static bool IsPrefetching(const char *path) {
+    if (!prefetchJob) return false;
+    for (int i = 0; i < prefetchCount; i++) {
+        if (strcmp(prefetchModels[i].path, path) == 0) return true;
+    }
+    return false;
+}
+
+/*
+ * Description: Finds the registry entry for a path, creating it if needed. A full registry recycles an
+ *              entry nothing holds (no references, not resident, no prefetched data).
+ * Parameters:
+ * - path: Source .obj path.
+ * Returns: The entry, or NULL if every entry is in use.
+ */
+static RegistryEntry *GetRegistryEntry(const char *path) {
+    RegistryEntry *entry = FindRegistryEntry(path);
+    if (entry) return entry;
+
+    if (registryCount < MAX_REGISTRY_ENTRIES) {
+        entry = &registry[registryCount++];
+    } else {
+        for (int i = 0; i < registryCount && !entry; i++) {
+            RegistryEntry *idle = &registry[i];
+            if (idle->refCount == 0 && !idle->resident && !idle->decoded && !idle->queued) entry = idle;
+        }
+        if (!entry) return NULL;
+    }
+
+    memset(entry, 0, sizeof(RegistryEntry));
+    snprintf(entry->path, ASSET_PATH_LEN, "%s", path);
+    return entry;
+}
+
+// --- MAIN FUNCTIONS ---
+
+/*
+ * Description: Loads a batch of OBJ models: mesh and texture decoding on the thread pool, GPU upload here.
+ * Parameters:
+ * - paths: Source .obj paths.
+ * - outModels: Receives one Model per path (meshCount == 0 on failure).
+ * - count: Number of models.
+ * Returns: None.
+ */
+void LoadModelBatch(const char **paths, Model *outModels, int count) {
+    if (count <= 0) return;
+    double startTime = GetTime();
+
+    if (!DirectoryExists(MESH_CACHE_DIR)) MakeDirectory(MESH_CACHE_DIR);
+
+    CpuModel *models = (CpuModel *)calloc(count, sizeof(CpuModel));
+    if (!models) return;
+    for (int i = 0; i < count; i++) snprintf(models[i].path, ASSET_PATH_LEN, "%s", paths[i]);
+
+    ParallelFor(count, 1, DecodeModelTask, models);
+    int fromCache = UploadCpuModels(models, outModels, count);
+    free(models);
+
+    printf("ASSETS: Loaded %d models (%d from cache) in %.1f ms\n", count, fromCache, (GetTime() - startTime) * 1000.0);
+}
+
+/*
+ * Description: Loads one OBJ model through the mesh cache.
+ * Parameters:
+ * - path: Source .obj path.
+ * Returns: The Model (meshCount == 0 on failure).
+ */
+Model LoadModelCached(const char *path) {
+    Model model = { 0 };
+    LoadModelBatch(&path, &model, 1);
+    return model;
+}
+
+/*
+ * Description: CPU half of LoadModelBatch for threads other than the main one: decodes meshes (cache read
+ *              or OBJ parse) and texture images. ParallelFor is main-thread only, so the batch is split
+ *              over background jobs and the calling thread instead.
+ * Parameters:
+ * - paths: Source .obj paths.
+ * - count: Number of models.
+ * Returns: The decoded batch for UploadModelBatch, or NULL if count <= 0 or out of memory.
+ */
+ModelBatch *DecodeModelBatch(const char **paths, int count) {
+    if (count <= 0) return NULL;
+
+    ModelBatch *batch = (ModelBatch *)calloc(1, sizeof(ModelBatch));
+    if (!batch) return NULL;
+    batch->models = (CpuModel *)calloc(count, sizeof(CpuModel));
+    batch->textures = (PendingTexture *)calloc(MAX_SHARED_TEXTURES, sizeof(PendingTexture));
+    if (!batch->models || !batch->textures) {
+        free(batch->models);
+        free(batch->textures);
+        free(batch);
+        return NULL;
+    }
+    batch->count = count;
+    for (int i = 0; i < count; i++) snprintf(batch->models[i].path, ASSET_PATH_LEN, "%s", paths[i]);
+
+    if (!DirectoryExists(MESH_CACHE_DIR)) MakeDirectory(MESH_CACHE_DIR);
+
+    int sliceCount = (count < 1 + MAX_DECODE_JOBS) ? count : 1 + MAX_DECODE_JOBS;
+    DecodeSlice slices[1 + MAX_DECODE_JOBS];
+    BackgroundJob *jobs[1 + MAX_DECODE_JOBS] = { 0 };
+    for (int s = 0; s < sliceCount; s++) {
+        slices[s] = (DecodeSlice){ batch->models, count * s / sliceCount, count * (s + 1) / sliceCount };
+        if (s > 0) jobs[s] = StartBackgroundJob(DecodeSliceTask, &slices[s]);
+    }
+    DecodeSliceTask(&slices[0]);
+    for (int s = 1; s < sliceCount; s++) {
+        if (jobs[s]) FinishBackgroundJob(jobs[s]);
+        else DecodeSliceTask(&slices[s]);
+    }
+
+    batch->textureCount = CollectPendingTextures(batch->models, count, batch->textures, false);
+    DecodeTextureTask(batch->textures, 0, batch->textureCount);
+    return batch;
+}
+
+/*
+ * Description: GPU half: uploads a batch from DecodeModelBatch (main thread only) and frees it.
+ * Parameters:
+ * - batch: Decoded batch (NULL is a no-op).
+ * - outModels: Receives one Model per path passed to DecodeModelBatch (meshCount == 0 on failure).
+ * Returns: None.
+ */
+void UploadModelBatch(ModelBatch *batch, Model *outModels) {
+    if (!batch) return;
+    double startTime = GetTime();
+
+    UploadPendingTextures(batch->textures, batch->textureCount);
+    int fromCache = UploadDecodedModels(batch->models, outModels, batch->count);
+    printf("ASSETS: Uploaded %d models (%d from cache) in %.1f ms\n", batch->count, fromCache, (GetTime() - startTime) * 1000.0);
+
+    free(batch->models);
+    free(batch->textures);
+    free(batch);
+}
+
+/*
+ * Description: Takes a reference on a batch of registry models, loading the ones that are not resident.
+ *              Prefetched models only need their GPU upload; the rest decode on the thread pool.
+ * Parameters:
+ * - paths: Source .obj paths.
+ * - outModels: Receives the shared Model for each path (meshCount == 0 on failure).
+ * - count: Number of models.
+ * Returns: None.
+ */
+void AcquireModels(const char **paths, Model *outModels, int count) {
+    if (count <= 0) return;
+
+    // Wait for an in-flight prefetch only if it holds something we need now
+    bool needPrefetch = false;
+    for (int i = 0; i < count; i++) if (IsPrefetching(paths[i])) needPrefetch = true;
+    CollectPrefetch(needPrefetch);
+
+    CpuModel *models = (CpuModel *)calloc(count, sizeof(CpuModel));
+    RegistryEntry **loading = (RegistryEntry **)calloc(count, sizeof(RegistryEntry *));
+    Model *uploaded = (Model *)calloc(count, sizeof(Model));
+    int loadCount = 0;
+    int prefetched = 0;
+
+    for (int i = 0; models && loading && uploaded && i < count; i++) {
+        RegistryEntry *entry = GetRegistryEntry(paths[i]);
+        if (!entry || entry->resident) continue;
+
+        bool queued = false;
+        for (int q = 0; q < loadCount; q++) if (loading[q] == entry) queued = true;
+        if (queued) continue;
+
+        if (entry->decoded) {
+            models[loadCount] = *entry->decoded;
+            free(entry->decoded);
+            entry->decoded = NULL;
+            prefetched++;
+        } else {
+            snprintf(models[loadCount].path, ASSET_PATH_LEN, "%s", paths[i]);
+        }
+        entry->queued = true;
+        loading[loadCount++] = entry;
+    }
+
+    if (loadCount > 0) {
+        double startTime = GetTime();
+        if (!DirectoryExists(MESH_CACHE_DIR)) MakeDirectory(MESH_CACHE_DIR);
+
+        ParallelFor(loadCount, 1, DecodeModelTask, models);
+        UploadCpuModels(models, uploaded, loadCount);
+        for (int q = 0; q < loadCount; q++) {
+            loading[q]->model = uploaded[q];
+            loading[q]->resident = true;
+            loading[q]->queued = false;
+            loading[q]->refCount = 0;
+        }
+        printf("ASSETS: Acquired %d models (%d prefetched) in %.1f ms\n", loadCount, prefetched, (GetTime() - startTime) * 1000.0);
+    }
+    free(models);
+    free(loading);
+    free(uploaded);
+
+    for (int i = 0; i < count; i++) {
+        RegistryEntry *entry = FindRegistryEntry(paths[i]);
+        if (entry && entry->resident) {
+            entry->refCount++;
+            outModels[i] = entry->model;
+        } else {
+            // Registry full of models in use: an untracked copy would never be released, so refuse
+            printf("ASSETS: ERROR: Model registry full (%d entries), cannot load %s\n", MAX_REGISTRY_ENTRIES, paths[i]);
+            outModels[i] = (Model){ 0 };
+        }
+    }
+}
+
+/*
+ * Description: Takes a reference on one registry model.
+ * Parameters:
+ * - path: Source .obj path.
+ * Returns: The shared Model (meshCount == 0 on failure).
+ */
+Model AcquireModel(const char *path) {
+    Model model = { 0 };
+    AcquireModels(&path, &model, 1);
+    return model;
+}
+
+/*
+ * Description: Drops references taken with AcquireModels; models reaching zero are unloaded.
+ * Parameters:
+ * - paths: Source .obj paths, as passed to AcquireModels.
+ * - count: Number of paths.
+ * Returns: None.
+ */
+void ReleaseModels(const char **paths, int count) {
+    for (int i = 0; i < count; i++) {
+        RegistryEntry *entry = FindRegistryEntry(paths[i]);
+        if (!entry || entry->refCount <= 0) continue;
+
+        if (--entry->refCount == 0) {
+            UnloadModel(entry->model);
+            entry->model = (Model){ 0 };
+            entry->resident = false;
+        }
+    }
+}
+
+void ReleaseModel(const char *path) {
+    ReleaseModels(&path, 1);
+}
+
+/*
+ * Description: Starts decoding models on a background thread so a later AcquireModels only uploads them.
+ *              Skips models that are resident or already decoded; one prefetch batch runs at a time.
+ * Parameters:
+ * - paths: Source .obj paths.
+ * - count: Number of paths.
+ * Returns: None.
+ */
+void PrefetchModels(const char **paths, int count) {
+    CollectPrefetch(false);
+    if (prefetchJob || count <= 0) return;
+
+    CpuModel *models = (CpuModel *)calloc(count, sizeof(CpuModel));
+    if (!models) return;
+
+    int queued = 0;
+    for (int i = 0; i < count; i++) {
+        RegistryEntry *entry = GetRegistryEntry(paths[i]);
+        if (!entry || entry->resident || entry->decoded) continue;
+
+        bool duplicate = false;
+        for (int q = 0; q < queued; q++) if (strcmp(models[q].path, paths[i]) == 0) duplicate = true;
+        if (!duplicate) snprintf(models[queued++].path, ASSET_PATH_LEN, "%s", paths[i]);
+    }
+
+    if (queued == 0) { free(models); return; }
+
+    if (!DirectoryExists(MESH_CACHE_DIR)) MakeDirectory(MESH_CACHE_DIR);
+    prefetchModels = models;
+    prefetchCount = queued;
+    prefetchJob = StartBackgroundJob(PrefetchTask, NULL);
+    if (!prefetchJob) {
+        free(prefetchModels);
+        prefetchModels = NULL;
+        prefetchCount = 0;
+        return;
+    }
+    printf("ASSETS: Prefetching %d models\n", queued);
+}
+
+/*
+ * Description: Per-frame housekeeping: picks up a finished prefetch without blocking.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UpdateAssetPrefetch(void) {
+    CollectPrefetch(false);
+}
+
+/*
+ * Description: Shutdown: waits for any prefetch, frees unused decoded data, unloads registry models that
+ *              are still referenced and the shared material textures.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UnloadAssetCache(void) {
+    CollectPrefetch(true);
+
+    for (int i = 0; i < registryCount; i++) {
+        RegistryEntry *entry = &registry[i];
+        if (entry->decoded) {
+            FreeCpuModel(entry->decoded);
+            free(entry->decoded);
+        }
+        if (entry->resident) UnloadModel(entry->model);
+    }
+    registryCount = 0;
+
+    for (int i = 0; i < sharedTextureCount; i++) {
+        if (sharedTextures[i].texture.id != 0) UnloadTexture(sharedTextures[i].texture);
+    }
+    sharedTextureCount = 0;
+}
@@ -0,0 +1,56 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include "raylib.h"
+
+// Loads a batch of OBJ models. Parsing runs on the thread pool and reads a binary mesh cache
+// (cache/*.mesh), rebuilding entries whose source .obj changed. Only the GPU upload runs on
+// the calling (main) thread. Failed entries come back with meshCount == 0.
+void LoadModelBatch(const char **paths, Model *outModels, int count);
+
+// Single-model version of LoadModelBatch
+Model LoadModelCached(const char *path);
+
+// LoadModelBatch split in two for loader threads: DecodeModelBatch does the CPU work (meshes and
+// texture images) and may run on any thread; UploadModelBatch uploads and frees the batch on the
+// main thread.
+typedef struct ModelBatch ModelBatch;
+ModelBatch *DecodeModelBatch(const char **paths, int count);
+void UploadModelBatch(ModelBatch *batch, Model *outModels);
+
+// --- Registry ---
+// Reference-counted models for assets that are only needed some of the time (dealership,
+// menu diorama). The first Acquire loads, the last Release unloads. Models handed out
+// are shared: callers must not UnloadModel them.
+void AcquireModels(const char **paths, Model *outModels, int count);
+Model AcquireModel(const char *path);
+void ReleaseModels(const char **paths, int count);
+void ReleaseModel(const char *path);
+
+// Decodes models on a background thread ahead of time; a later Acquire only uploads them
+void PrefetchModels(const char **paths, int count);
+
+// Per-frame: collects a finished prefetch without blocking
+void UpdateAssetPrefetch(void);
+
+// Shutdown: unloads registry models and the material textures shared between cached
+// models (UnloadModel leaves those alone). Call once, before CloseWindow.
+void UnloadAssetCache(void);
+
+#endif
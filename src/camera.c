@@ -87,21 +87,15 @@ void Update_Camera(Vector3 player_position, GameMap *map, float player_angle, fl
     targetOffset.y = camHeight;
 
     // --- 3. COLLISION CHECK ---
+    // [OPTIMIZATION] One raycast along the boom (first wall hit) instead of five sampled point checks
     float currentDist = maxCamDist; 
-    float dx = targetOffset.x;
-    float dz = targetOffset.z;
-    
-    int steps = 4; 
-    for (int i = 0; i <= steps; i++) {
-        float t = 0.2f + ((float)i / steps) * 0.8f;
-        float checkX = player_position.x + (dx * t);
-        float checkZ = player_position.z + (dz * t);
-
-        if (CheckMapCollision(map, checkX, checkZ, 0.3f, 1)) {
-            currentDist = (t * maxCamDist) - 0.2f;
-            if (currentDist < 0.5f) currentDist = 0.5f;
-            break; 
-        }
+    Vector2 boomStart = { player_position.x, player_position.z };
+    Vector2 boom = { targetOffset.x, targetOffset.z };
+
+    MapSweepHit hit = SweepMapCollision(map, boomStart, boom, 0.3f, true);
+    if (hit.hit) {
+        currentDist = (hit.time * maxCamDist) - 0.2f;
+        if (currentDist < 0.5f) currentDist = 0.5f;
     }
 
     // --- 4. SMOOTH DISTANCE ---
@@ -17,6 +17,7 @@
 #include "dealership.h"
 #include "raymath.h"
 #include "player.h" 
+#include "asset_cache.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -24,6 +25,9 @@
 #define MAX_CARS 7
 #define DEALERSHIP_LOCATION (Vector3){ 50.0f, 0.0f, 50.0f } 
 #define TRIGGER_RADIUS 5.0f
+#define PREFETCH_RADIUS 80.0f   // Start decoding showroom models when this close to a dealership
+#define PROP_MODEL_COUNT 10
+#define MAX_SHOWROOM_MODELS (PROP_MODEL_COUNT + MAX_CARS * 2)
 
 // --- Internal Structures ---
 
@@ -69,6 +73,31 @@ static Model containerOpenModel;
 static Model skipModel;
 static Model floorPanelModel;
 
+static const char *propModelPaths[PROP_MODEL_COUNT] = {
+    "resources/Dealership/table-large.obj",
+    "resources/Dealership/computer-screen.obj",
+    "resources/Dealership/display-wall-wide.obj",
+    "resources/Dealership/computer-system.obj",
+    "resources/Props/cone.obj",
+    "resources/Dealership/rail.obj",
+    "resources/Dealership/container.obj",
+    "resources/Dealership/container-flat-open.obj",
+    "resources/Dealership/skip.obj",
+    "resources/Dealership/structure-panel.obj"
+};
+static Model *propModelTargets[PROP_MODEL_COUNT] = {
+    &tableModel, &screenModel, &wallModel, &systemModel, &coneModel,
+    &railModel, &containerModel, &containerOpenModel, &skipModel, &floorPanelModel
+};
+
+// Everything the showroom draws, held through the asset registry only while inside
+static char showroomPathBuffers[MAX_SHOWROOM_MODELS][128];
+static const char *showroomPaths[MAX_SHOWROOM_MODELS];
+static Model *showroomTargets[MAX_SHOWROOM_MODELS];
+static int showroomModelCount = 0;
+static bool showroomAcquired = false;
+static bool prefetchRequested = false;
+
 static Camera3D shopCamera;
 static CarEntry carDatabase[MAX_CARS];
 static int currentSelection = 0;
@@ -240,26 +269,44 @@ void InitCarDatabase() {
 // --- Lifecycle Functions ---
 
 /*
- * Description: Initializes the dealership system, including 3D models and the camera.
+ * Description: Builds the list of showroom model paths (props + every car in the database).
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BuildShowroomModelList(void) {
+    showroomModelCount = 0;
+
+    for (int i = 0; i < PROP_MODEL_COUNT; i++) {
+        showroomPaths[showroomModelCount] = propModelPaths[i];
+        showroomTargets[showroomModelCount++] = propModelTargets[i];
+    }
+
+    for (int i = 0; i < MAX_CARS; i++) {
+        if (strlen(carDatabase[i].base.modelFileName) == 0) continue;
+
+        char *buffer = showroomPathBuffers[showroomModelCount];
+        sprintf(buffer, "resources/Playermodels/%s", carDatabase[i].base.modelFileName);
+        showroomPaths[showroomModelCount] = buffer;
+        showroomTargets[showroomModelCount++] = &carDatabase[i].modelBase;
+
+        if (carDatabase[i].hasUpgrade) {
+            buffer = showroomPathBuffers[showroomModelCount];
+            sprintf(buffer, "resources/Playermodels/%s", carDatabase[i].upgrade.modelFileName);
+            showroomPaths[showroomModelCount] = buffer;
+            showroomTargets[showroomModelCount++] = &carDatabase[i].modelUpgrade;
+        }
+    }
+}
+
+/*
+ * Description: Initializes the dealership system (car database and camera). Models load lazily on entry.
  * Parameters: None.
  * Returns: None.
  */
 void InitDealership() {
     InitCarDatabase();
-    
-    // Core Models
-    tableModel = LoadModel("resources/Dealership/table-large.obj");
-    screenModel = LoadModel("resources/Dealership/computer-screen.obj");
-    wallModel = LoadModel("resources/Dealership/display-wall-wide.obj");
-    systemModel = LoadModel("resources/Dealership/computer-system.obj");
-    
-    // New Props
-    coneModel = LoadModel("resources/Props/cone.obj");
-    railModel = LoadModel("resources/Dealership/rail.obj");
-    containerModel = LoadModel("resources/Dealership/container.obj");
-    containerOpenModel = LoadModel("resources/Dealership/container-flat-open.obj");
-    skipModel = LoadModel("resources/Dealership/skip.obj");
-    floorPanelModel = LoadModel("resources/Dealership/structure-panel.obj");
+    BuildShowroomModelList();
+    prefetchRequested = false;
     
     // Setup Camera 
     shopCamera.position = (Vector3){ 12.0f, 7.0f, 12.0f };
@@ -270,21 +317,30 @@ void InitDealership() {
 }
 
 /*
- * Description: Unloads all models associated with the dealership to free memory.
+ * Description: Releases any showroom models still held (game reset while inside the dealership).
  * Parameters: None.
  * Returns: None.
  */
 void UnloadDealershipSystem() {
-    UnloadModel(tableModel);
-    UnloadModel(screenModel);
-    UnloadModel(wallModel);
-    UnloadModel(systemModel);
-    UnloadModel(coneModel);
-    UnloadModel(railModel);
-    UnloadModel(containerModel);
-    UnloadModel(containerOpenModel);
-    UnloadModel(skipModel);
-    UnloadModel(floorPanelModel);
+    if (showroomAcquired) ExitDealership();
+    prefetchRequested = false;
+}
+
+/*
+ * Description: Starts a background prefetch of the showroom models when the player nears a dealership.
+ * Parameters:
+ * - playerPos: Player world position.
+ * - map: Map holding the dealership locations.
+ * Returns: None.
+ */
+void UpdateDealershipPrefetch(Vector3 playerPos, GameMap *map) {
+    UpdateAssetPrefetch();
+    if (currentState == DEALERSHIP_ACTIVE) return;
+
+    int nearby[1];
+    bool isNear = GetLocationsInRadius(map, (Vector2){ playerPos.x, playerPos.z }, PREFETCH_RADIUS, LOC_DEALERSHIP, nearby, 1) > 0;
+    if (isNear && !prefetchRequested) PrefetchModels(showroomPaths, showroomModelCount);
+    prefetchRequested = isNear;
 }
 
 /*
@@ -297,7 +353,7 @@ DealershipState GetDealershipState() {
 }
 
 /*
- * Description: Transitions the game into the dealership mode and loads vehicle models for display.
+ * Description: Transitions the game into the dealership mode and acquires the showroom models.
  * Parameters:
  * - player: Pointer to the player (unused in function body but kept for signature consistency).
  * Returns: None.
@@ -308,33 +364,27 @@ void EnterDealership(Player *player) {
     viewingUpgrade = false;
     carRotation = 0.0f;
 
-    char pathBuffer[128];
-    for (int i = 0; i < MAX_CARS; i++) {
-        if (strlen(carDatabase[i].base.modelFileName) == 0) continue;
+    if (showroomAcquired) return;
 
-        sprintf(pathBuffer, "resources/Playermodels/%s", carDatabase[i].base.modelFileName);
-        carDatabase[i].modelBase = LoadModel(pathBuffer);
-        
-        if (carDatabase[i].hasUpgrade) {
-            sprintf(pathBuffer, "resources/Playermodels/%s", carDatabase[i].upgrade.modelFileName);
-            carDatabase[i].modelUpgrade = LoadModel(pathBuffer);
-        }
-    }
+    // Only uploads if the prefetch already decoded them on the way here
+    Model loaded[MAX_SHOWROOM_MODELS];
+    AcquireModels(showroomPaths, loaded, showroomModelCount);
+    for (int i = 0; i < showroomModelCount; i++) *showroomTargets[i] = loaded[i];
+    showroomAcquired = true;
 }
 
 /*
- * Description: Exits the dealership mode and unloads vehicle display models.
+ * Description: Exits the dealership mode and releases the showroom models.
  * Parameters: None.
  * Returns: None.
  */
 void ExitDealership() {
     currentState = DEALERSHIP_INACTIVE;
-    for (int i = 0; i < MAX_CARS; i++) {
-        UnloadModel(carDatabase[i].modelBase);
-        if (carDatabase[i].hasUpgrade) {
-            UnloadModel(carDatabase[i].modelUpgrade);
-        }
-    }
+    if (!showroomAcquired) return;
+
+    ReleaseModels(showroomPaths, showroomModelCount);
+    for (int i = 0; i < showroomModelCount; i++) *showroomTargets[i] = (Model){ 0 };
+    showroomAcquired = false;
 }
 
 // --- Logic & Rendering ---
@@ -353,7 +403,7 @@ void ApplyCarToPlayer(Player *player, CarStats stats, Model sourceModel) {
 
     char pathBuffer[128];
     sprintf(pathBuffer, "resources/Playermodels/%s", stats.modelFileName);
-    player->model = LoadModel(pathBuffer);
+    player->model = LoadModelCached(pathBuffer);
     
     strcpy(player->currentModelFileName, stats.modelFileName);
 
@@ -390,7 +440,7 @@ void SelectCar(Player *player, CarStats stats, Model sourceModel, int index, boo
 
     char pathBuffer[128];
     sprintf(pathBuffer, "resources/Playermodels/%s", stats.modelFileName);
-    player->model = LoadModel(pathBuffer);
+    player->model = LoadModelCached(pathBuffer);
     strcpy(player->currentModelFileName, stats.modelFileName);
 
     // Apply Physics
@@ -20,6 +20,7 @@
 #include "raylib.h"
 #include "player.h"
 typedef struct Player Player;
+typedef struct GameMap GameMap;
 
 // State management for the main game loop
 typedef enum {
@@ -27,12 +28,15 @@ typedef enum {
     DEALERSHIP_INACTIVE
 } DealershipState;
 
-// Initialize the dealership (load static room assets)
+// Initialize the dealership (car database; room assets load on entry)
 void InitDealership();
 
-// Cleanup dealership (unload static room assets)
+// Cleanup dealership (release room assets if still inside)
 void UnloadDealershipSystem();
 
+// Per-frame: prefetches room assets in the background when the player is near a dealership
+void UpdateDealershipPrefetch(Vector3 playerPos, GameMap *map);
+
 // Call this when the player triggers the entrance
 void EnterDealership(Player *player);
 
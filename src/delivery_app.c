@@ -15,6 +15,7 @@
  */
 
 #include "delivery_app.h"
+#include "replay.h"
 #include "raymath.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -66,10 +67,7 @@ typedef enum {
 static AppScreenState currentScreen = SCREEN_HOME;
 static int selectedJobIndex = -1;
 static float eventFallbackTimer = 120.0f; 
-
-// Static variables to track physics state between frames
-static Vector2 lastFrameVelocity = { 0.0f, 0.0f };
-static bool physicsInitialized = false;
+static double deliveryClock = 0.0;
 
 // Static variables for interaction
 static float interactionTimer = 0.0f;
@@ -128,7 +126,7 @@ static int GetRandomHouseIndex(GameMap *map) {
  * Returns: None.
  */
 static void GenerateJobDetails(DeliveryTask *t, int locationType) {
-    t->creationTime = GetTime();
+    t->creationTime = deliveryClock;
     t->refreshTimer = GetRandomValue(120, 300); 
     t->fragility = 0.0f;
     t->isHeavy = false;
@@ -190,6 +188,33 @@ void InitDeliveryApp(PhoneState *phone, GameMap *map) {
     }
 }
 
+/*
+ * Description: Resolves the smart pickup and dropoff positions for a job once, so callers
+ * don't re-run GetSmartDeliveryPos every frame. Call whenever the task's positions change.
+ * Parameters:
+ * - task: The task to update.
+ * - map: Pointer to GameMap.
+ * Returns: None.
+ */
+void CacheDeliveryZones(DeliveryTask *task, GameMap *map) {
+    task->pickupZonePos = GetSmartDeliveryPos(map, (Vector3){ task->restaurantPos.x, 0.0f, task->restaurantPos.y });
+    task->dropoffZonePos = GetSmartDeliveryPos(map, (Vector3){ task->customerPos.x, 0.0f, task->customerPos.y });
+    task->zoneMapId = map->loadId;
+}
+
+/*
+ * Description: Returns the cached zone for the task's current leg (pickup while accepted, dropoff
+ * once picked up). Recomputes if the cache was made for a different map.
+ * Parameters:
+ * - task: The active task.
+ * - map: Pointer to GameMap.
+ * Returns: The 3D zone position.
+ */
+Vector3 GetDeliveryZonePos(DeliveryTask *task, GameMap *map) {
+    if (task->zoneMapId != map->loadId) CacheDeliveryZones(task, map);
+    return (task->status == JOB_PICKED_UP) ? task->dropoffZonePos : task->pickupZonePos;
+}
+
 /*
  * Description: Renders the player profile screen showing earnings and stats.
  * Parameters:
@@ -342,7 +367,7 @@ static void DrawHomeScreen(PhoneState *phone, Player *player, Rectangle screenRe
     
     for (int i = 0; i < 5; i++) {
         DeliveryTask *t = &phone->tasks[i];
-        if (t->status == JOB_DELIVERED && GetTime() - t->creationTime < 3.0) continue; 
+        if (t->status == JOB_DELIVERED && deliveryClock - t->creationTime < 3.0) continue; 
         if (t->status == JOB_DELIVERED) continue; 
         if (strlen(t->restaurant) == 0 && t->pay == 0) continue;
         
@@ -392,47 +417,73 @@ void DrawDeliveryApp(PhoneState *phone, Player *player, GameMap *map, Vector2 mo
     }
 }
 
+/*
+ * Description: Advances the job clock by one simulation step.
+ * Parameters:
+ * - dt: Simulation delta time.
+ * Returns: None.
+ */
+void AdvanceDeliveryClock(float dt) {
+    deliveryClock += dt;
+}
+
+/*
+ * Description: Current job clock, the time base for DeliveryTask.creationTime.
+ * Parameters: None.
+ * Returns: Simulated seconds since startup.
+ */
+double GetDeliveryClock(void) {
+    return deliveryClock;
+}
+
+/*
+ * Description: Captures the delivery app's frame-to-frame timers.
+ * Parameters: None.
+ * Returns: The current timer state.
+ */
+DeliverySimState GetDeliverySimState(void) {
+    return (DeliverySimState){ deliveryClock, eventFallbackTimer, interactionTimer, ignorePhysicsFrame };
+}
+
+/*
+ * Description: Restores timers captured by GetDeliverySimState.
+ * Parameters:
+ * - state: State to restore.
+ * Returns: None.
+ */
+void SetDeliverySimState(const DeliverySimState *state) {
+    deliveryClock = state->clock;
+    eventFallbackTimer = state->eventFallbackTimer;
+    interactionTimer = state->interactionTimer;
+    ignorePhysicsFrame = state->ignorePhysicsFrame;
+}
+
 /*
  * Description: Updates background logic including physics (damage), random events, and job timers.
  * Parameters:
  * - phone: Pointer to PhoneState.
  * - player: Pointer to Player.
  * - map: Pointer to GameMap.
+ * - dt: Simulation delta time.
  * Returns: None.
  */
-void UpdateDeliveryApp(PhoneState *phone, Player *player, GameMap *map) {
-    double currentTime = GetTime();
-    float dt = GetFrameTime();
+void UpdateDeliveryApp(PhoneState *phone, Player *player, GameMap *map, float dt) {
+    double currentTime = deliveryClock;
     if (dt == 0) dt = 0.016f; // Safety for first frame
 
     // --- 1. CALCULATE REAL G-FORCE ---
-    // Convert player speed & angle into a 2D Velocity Vector
-    float rad = player->angle * DEG2RAD;
-    Vector2 currentVelocity = { sinf(rad) * player->current_speed, cosf(rad) * player->current_speed };
+    // [FIX] Measured by the fixed-step player physics over 1/60s windows instead of dv / frame dt,
+    // so the same driving gives the same reading at any frame rate
+    float rawG = ConsumePlayerGForce(player);
 
-    if (!physicsInitialized) {
-        lastFrameVelocity = currentVelocity;
-        physicsInitialized = true;
-    }
     if (ignorePhysicsFrame) {
-        lastFrameVelocity = currentVelocity; // Sync velocity so next frame is smooth
-        physicsInitialized = true;
         ignorePhysicsFrame = false; // Reset flag
         return; // Skip damage logic this frame
     }
     
-    // Calculate the difference vector (Change in velocity)
-    Vector2 deltaV = Vector2Subtract(currentVelocity, lastFrameVelocity);
-    
-    // G-Force calculation
-    float rawG = (Vector2Length(deltaV) / dt) * 0.02f; 
-    
     // Apply a floor to ignore tiny vibrations
     if (rawG < 0.1f) rawG = 0.0f;
 
-    // Store for next frame
-    lastFrameVelocity = currentVelocity;
-
     // --- 2. UPDATE LOGIC ---
     eventFallbackTimer -= dt;
     if (eventFallbackTimer <= 0) {
@@ -456,6 +507,7 @@ void UpdateDeliveryApp(PhoneState *phone, Player *player, GameMap *map) {
                     t->distance = Vector2Distance(t->restaurantPos, t->customerPos);
                     t->status = JOB_AVAILABLE;
                     GenerateJobDetails(t, map->locations[storeIdx].type);
+                    CacheDeliveryZones(t, map);
                  }
              }
         }
@@ -548,21 +600,11 @@ void UpdateDeliveryInteraction(PhoneState *phone, Player *player, GameMap *map,
 
     for(int i = 0; i < 5; i++) {
         DeliveryTask *t = &phone->tasks[i];
-        Vector3 targetPos = {0};
-        bool validTask = false;
-
-        // Check task status
-        if (t->status == JOB_ACCEPTED) {
-            targetPos = (Vector3){ t->restaurantPos.x, 0.0f, t->restaurantPos.y };
-            validTask = true;
-        } else if (t->status == JOB_PICKED_UP) {
-            targetPos = (Vector3){ t->customerPos.x, 0.0f, t->customerPos.y };
-            validTask = true;
-        }
+        bool validTask = (t->status == JOB_ACCEPTED || t->status == JOB_PICKED_UP);
 
         if (validTask) {
-            // 1. Get smart position
-            Vector3 smartPos = GetSmartDeliveryPos(map, targetPos);
+            // 1. Get smart position (cached per job)
+            Vector3 smartPos = GetDeliveryZonePos(t, map);
 
             // 2. Check Distance
             float dist = Vector2Distance(
@@ -574,7 +616,7 @@ void UpdateDeliveryInteraction(PhoneState *phone, Player *player, GameMap *map,
                 isPlayerNearBox = true;
 
                 // 3. Check Input
-                if (IsKeyDown(KEY_E)) {
+                if (ReplayKeyDown(KEY_E)) {
                     interactionTimer += dt;
 
                     // 4. Trigger Action (4 Seconds)
@@ -583,7 +625,7 @@ void UpdateDeliveryInteraction(PhoneState *phone, Player *player, GameMap *map,
                         // --- PICKUP ---
                         if (t->status == JOB_ACCEPTED) {
                             t->status = JOB_PICKED_UP;
-                            t->creationTime = GetTime(); 
+                            t->creationTime = deliveryClock; 
                             SetMapDestination(map, t->customerPos);
                             TriggerPickupAnimation(smartPos);
                             ShowPhoneNotification("Order Picked Up!", COLOR_ACCENT);
@@ -602,7 +644,7 @@ void UpdateDeliveryInteraction(PhoneState *phone, Player *player, GameMap *map,
                             player->totalDeliveries++;
 
                             // Tip Logic
-                            double realElapsed = GetTime() - t->creationTime;
+                            double realElapsed = deliveryClock - t->creationTime;
                             double effectiveElapsed = realElapsed * player->insulationFactor;
                             float tip = 0.0f;
 
@@ -29,8 +29,24 @@
 // Initialize the app (fills empty jobs)
 void InitDeliveryApp(PhoneState *phone, GameMap *map);
 void SetIgnorePhysics();
-// Update logic (Physics, Timers, Earnings)
-void UpdateDeliveryApp(PhoneState *phone, Player *player, GameMap *map);
+// Update logic (Physics, Timers, Earnings). dt is the simulation step.
+void UpdateDeliveryApp(PhoneState *phone, Player *player, GameMap *map, float dt);
+
+// Job clock (creationTime, refresh timers, time limits). Advanced once per simulation step
+// instead of read from the window, so headless runs and replays see simulated time.
+void AdvanceDeliveryClock(float dt);
+double GetDeliveryClock(void);
+
+// Timers the delivery app carries between frames, snapshotted by replays
+typedef struct DeliverySimState {
+    double clock;
+    float eventFallbackTimer;
+    float interactionTimer;
+    bool ignorePhysicsFrame;
+} DeliverySimState;
+
+DeliverySimState GetDeliverySimState(void);
+void SetDeliverySimState(const DeliverySimState *state);
 
 // Draw the UI (Home, Details, Profile)
 // ERROR FIX: Added 'Player *player' here to match the .c file
@@ -38,6 +54,8 @@ void DrawDeliveryApp(PhoneState *phone, Player *player, GameMap *map, Vector2 mo
 void TriggerPickupAnimation(Vector3 itemPos);
 void TriggerDropoffAnimation(Vector3 playerPos, Vector3 targetGroundPos);
 Vector3 GetSmartDeliveryPos(GameMap *map, Vector3 buildingCenter); 
+void CacheDeliveryZones(DeliveryTask *task, GameMap *map);
+Vector3 GetDeliveryZonePos(DeliveryTask *task, GameMap *map);
 void UpdateAndDrawPickupEffects(Vector3 playerPos);
 void UpdateDeliveryInteraction(PhoneState *phone, Player *player, GameMap *map, float dt);
 bool IsInteractionActive(void);
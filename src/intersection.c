@@ -0,0 +1,163 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#include "intersection.h"
+#include "raymath.h"
+#include "map.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+// --- SIGNAL TIMING (seconds) ---
+#define SIGNAL_GREEN_TIME 8.0f
+#define SIGNAL_YELLOW_TIME 2.0f
+#define SIGNAL_ALL_RED_TIME 1.0f
+#define SIGNAL_CYCLE_TIME (2.0f * (SIGNAL_GREEN_TIME + SIGNAL_YELLOW_TIME + SIGNAL_ALL_RED_TIME))
+
+// Unflagged junctions with at least this many roads get a signal automatically
+#define AUTO_SIGNAL_MIN_DEGREE 4
+
+// Two axes take turns: North/South (Z) and East/West (X)
+typedef enum {
+    PHASE_NS_GREEN = 0,
+    PHASE_NS_YELLOW,
+    PHASE_NS_CLEAR,
+    PHASE_EW_GREEN,
+    PHASE_EW_YELLOW,
+    PHASE_EW_CLEAR
+} SignalPhase;
+
+/*
+ * Description: Builds per-node control data from Node.flags (1/2 = traffic light, 3 = stop sign).
+ * Busy unflagged junctions (AUTO_SIGNAL_MIN_DEGREE+ roads) are signalised as well, since most
+ * shipped maps carry no flags.
+ * Parameters:
+ * - sys: Intersection system to fill.
+ * - map: Pointer to GameMap.
+ * Returns: None.
+ */
+void InitIntersections(IntersectionSystem *sys, GameMap *map) {
+    UnloadIntersections(sys);
+    if (map->nodeCount <= 0) return;
+
+    sys->nodeCount = map->nodeCount;
+    sys->control = (unsigned char *)calloc(map->nodeCount, sizeof(unsigned char));
+    sys->phase = (unsigned char *)calloc(map->nodeCount, sizeof(unsigned char));
+    sys->offset = (float *)calloc(map->nodeCount, sizeof(float));
+    sys->signalNodes = (int *)malloc(map->nodeCount * sizeof(int));
+    sys->signalCount = 0;
+    sys->clock = 0.0f;
+
+    int *degree = (int *)calloc(map->nodeCount, sizeof(int));
+    for (int i = 0; i < map->edgeCount; i++) {
+        degree[map->edges[i].startNode]++;
+        degree[map->edges[i].endNode]++;
+    }
+
+    int stopCount = 0;
+    for (int i = 0; i < map->nodeCount; i++) {
+        int flags = map->nodes[i].flags;
+        if (flags == 3) {
+            sys->control[i] = CONTROL_STOP;
+            stopCount++;
+        } else if (flags == 1 || flags == 2 || degree[i] >= AUTO_SIGNAL_MIN_DEGREE) {
+            sys->control[i] = CONTROL_SIGNAL;
+            sys->offset[i] = (float)(((unsigned int)i * 2654435761u) % 1000u) / 1000.0f * SIGNAL_CYCLE_TIME;
+            sys->signalNodes[sys->signalCount++] = i;
+        }
+    }
+    free(degree);
+
+    UpdateIntersections(sys, 0.0f);
+    printf("INTERSECTIONS: %d signals, %d stop signs.\n", sys->signalCount, stopCount);
+}
+
+/*
+ * Description: Frees all intersection arrays.
+ * Parameters:
+ * - sys: Intersection system.
+ * Returns: None.
+ */
+void UnloadIntersections(IntersectionSystem *sys) {
+    free(sys->control);
+    free(sys->phase);
+    free(sys->offset);
+    free(sys->signalNodes);
+    *sys = (IntersectionSystem){ 0 };
+}
+
+/*
+ * Description: Puts every signal back at the start of its cycle.
+ * Parameters:
+ * - sys: Intersection system.
+ * Returns: None.
+ */
+void ResetIntersections(IntersectionSystem *sys) {
+    sys->clock = 0.0f;
+    UpdateIntersections(sys, 0.0f);
+}
+
+/*
+ * Description: Advances the shared clock and recomputes the phase of every signal in one pass.
+ * Parameters:
+ * - sys: Intersection system.
+ * - dt: Delta Time.
+ * Returns: None.
+ */
+void UpdateIntersections(IntersectionSystem *sys, float dt) {
+    if (sys->nodeCount == 0) return;
+
+    sys->clock = fmodf(sys->clock + dt, SIGNAL_CYCLE_TIME);
+
+    const float halfCycle = SIGNAL_CYCLE_TIME * 0.5f;
+    for (int k = 0; k < sys->signalCount; k++) {
+        int node = sys->signalNodes[k];
+        float t = fmodf(sys->clock + sys->offset[node], SIGNAL_CYCLE_TIME);
+
+        int base = PHASE_NS_GREEN;
+        if (t >= halfCycle) { base = PHASE_EW_GREEN; t -= halfCycle; }
+
+        if (t < SIGNAL_GREEN_TIME) sys->phase[node] = (unsigned char)base;
+        else if (t < SIGNAL_GREEN_TIME + SIGNAL_YELLOW_TIME) sys->phase[node] = (unsigned char)(base + 1);
+        else sys->phase[node] = (unsigned char)(base + 2);
+    }
+}
+
+/*
+ * Description: Looks up what a vehicle approaching nodeID from fromNodeID must do.
+ * Parameters:
+ * - sys: Intersection system.
+ * - map: Pointer to GameMap.
+ * - nodeID: Intersection node.
+ * - fromNodeID: Node the vehicle is coming from (defines the approach axis).
+ * Returns: SignalState for that approach.
+ */
+SignalState GetSignalState(const IntersectionSystem *sys, GameMap *map, int nodeID, int fromNodeID) {
+    if (nodeID < 0 || nodeID >= sys->nodeCount) return SIGNAL_NONE;
+
+    unsigned char control = sys->control[nodeID];
+    if (control == CONTROL_NONE) return SIGNAL_NONE;
+    if (control == CONTROL_STOP) return SIGNAL_STOP;
+
+    Vector2 dir = Vector2Subtract(map->nodes[nodeID].position, map->nodes[fromNodeID].position);
+    bool northSouth = fabsf(dir.y) >= fabsf(dir.x);
+
+    int phase = sys->phase[nodeID];
+    int greenPhase = northSouth ? PHASE_NS_GREEN : PHASE_EW_GREEN;
+    if (phase == greenPhase) return SIGNAL_GREEN;
+    if (phase == greenPhase + 1) return SIGNAL_YELLOW;
+    return SIGNAL_RED;
+}
@@ -0,0 +1,62 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INTERSECTION_H
+#define INTERSECTION_H
+
+#include "raylib.h"
+
+typedef struct GameMap GameMap;
+
+// Per-node control type, derived from Node.flags (see InitIntersections)
+typedef enum {
+    CONTROL_NONE = 0,
+    CONTROL_SIGNAL,
+    CONTROL_STOP
+} IntersectionControl;
+
+// What an approaching vehicle sees
+typedef enum {
+    SIGNAL_NONE = 0,  // Uncontrolled
+    SIGNAL_GREEN,
+    SIGNAL_YELLOW,
+    SIGNAL_RED,
+    SIGNAL_STOP       // Stop sign: halt, then proceed
+} SignalState;
+
+typedef struct IntersectionSystem {
+    int nodeCount;
+    unsigned char *control;   // IntersectionControl per node
+    unsigned char *phase;     // Current signal phase per node (bulk-updated)
+    float *offset;            // Cycle offset per node so neighbours don't switch in lockstep
+    int *signalNodes;         // Indices of CONTROL_SIGNAL nodes
+    int signalCount;
+    float clock;
+} IntersectionSystem;
+
+void InitIntersections(IntersectionSystem *sys, GameMap *map);
+void UnloadIntersections(IntersectionSystem *sys);
+
+// Rewinds the signal clock so every light restarts its cycle (replay start)
+void ResetIntersections(IntersectionSystem *sys);
+
+// Advances every signal once per tick
+void UpdateIntersections(IntersectionSystem *sys, float dt);
+
+// O(1): state of nodeID as seen by a vehicle arriving from fromNodeID
+SignalState GetSignalState(const IntersectionSystem *sys, GameMap *map, int nodeID, int fromNodeID);
+
+#endif
@@ -33,6 +33,12 @@
 #include "save.h"
 #include "dealership.h"
 #include "tutorial.h"
+#include "thread_pool.h"
+#include "perf_overlay.h"
+#include "profiler.h"
+#include "replay.h"
+#include "asset_cache.h"
+#include "music_player.h"
 
 /*
  * Description: Checks for the 'resources' directory and adjusts the working directory if necessary.
@@ -71,39 +77,26 @@ int main(void)
     UnloadImage(icon);
     
     InitAudioDevice(); 
+    InitThreadPool(0);
+    StartMusicPlayer(); // Audio worker: music keeps streaming through loads and menus
 
     // Outer loop for Game/Menu resets
     while (!WindowShouldClose()) {
         
         if (!RunStartMenu_PreLoad(GetScreenWidth(), GetScreenHeight())) {
+            CancelMapLoad();
+            StopMusicPlayer();
+            UnloadAssetCache();
+            ShutdownThreadPool();
             CloseWindow();
             return 0; // User closed window
         }
 
-        // Determine Map File
-        const char* mapPath = "resources/maps/real_city.map"; // Default
-
-        if (FileExists("map_config.dat")) {
-            FILE *f = fopen("map_config.dat", "rb");
-            if (f) {
-                int choice = 1;
-                fread(&choice, sizeof(int), 1, f);
-                fclose(f);
-                
-                if (choice == 2) {
-                    mapPath = "resources/maps/smaller_city.map"; // Big City
-                    printf("MAIN: Loading Big City based on user choice.\n");
-                } else {
-                    printf("MAIN: Loading Small City based on user choice.\n");
-                }
-            }
-        } else {
-            // If no config found, default to Small City
-            printf("MAIN: No config found, defaulting to Small City.\n");
-        }
-
-        // Load the chosen map
-        GameMap map = LoadGameMap(mapPath);
+        // The menu started the map load on a background thread; upload the starting zone and take it
+        const char* mapPath = GetChosenMapPath();
+        PROFILE_BEGIN("FinishMapLoad");
+        GameMap map = FinishMapLoad();
+        PROFILE_END();
         LoadMapBoundaries(mapPath);
 
         Vector3 startPos = {0, 0, 0};
@@ -127,7 +120,8 @@ int main(void)
         InitTutorial();
         InitDealership();
 
-        // Attempt Auto-Load
+        // Attempt Auto-Load (restores jobs, events and traffic too when saved on this map)
+        BindSaveWorld(&map, &traffic);
         if (LoadGame(&player, &phone)) {
             printf("Save file loaded successfully.\n");
         } else {
@@ -148,7 +142,15 @@ int main(void)
 
         // Inner Gameplay Loop
         while (!WindowShouldClose()) {
-            float dt = GetFrameTime();
+            // F9 / F10: Record or replay the session (dt, RNG seed and keys per frame)
+            UpdateReplayHotkeys(&player, &phone, &map, &traffic);
+            float dt = UpdateReplayFrame(GetFrameTime());
+            AdvanceDeliveryClock(dt);
+            PerfBeginFrame();
+            PROFILE_BEGIN("Frame");
+            UpdatePerfOverlay();
+            // F8: Dump the last 10 seconds of profiler zones
+            if (IsKeyPressed(KEY_F8)) PROFILE_DUMP("profile_trace.json", 10.0);
             
             // --- 1. UPDATE PHASE ---
             bool lockInput = UpdateTutorial(&player, &phone, &map, dt, isRefueling, isMechanicOpen);
@@ -157,6 +159,13 @@ int main(void)
                 UpdateDeliveryInteraction(&phone, &player, &map, dt);
             }
 
+            UpdateDealershipPrefetch(player.position, &map);
+
+            // Finish background save writes; autosave while the run is live (never during playback)
+            bool canAutosave = !isDead && frameCounter > WARMUP_FRAMES && GetReplayMode() != REPLAY_PLAYING
+                               && GetDealershipState() != DEALERSHIP_ACTIVE;
+            UpdateSaveService(&player, &phone, dt, canAutosave);
+
             if (GetDealershipState() == DEALERSHIP_ACTIVE) {
                 UpdateDealership(&player);
             }
@@ -172,39 +181,30 @@ int main(void)
                     AddMoney(&player, "Hospital Bills", -penalty); 
 
                     // Find Nearest Mechanic for respawn
-                    float minDst = 999999.0f;
                     Vector2 pPos2 = { player.position.x, player.position.z };
                     respawnPoint = startPos; 
 
-                    for(int i = 0; i < map.locationCount; i++) {
-                        if (map.locations[i].type == LOC_MECHANIC) {
-                            Vector2 mechPos = map.locations[i].position;
-                            float dst = Vector2Distance(pPos2, mechPos);
-                            if (dst < minDst) {
-                                minDst = dst;
-                                respawnPoint = (Vector3){ mechPos.x, 0.5f, mechPos.y }; 
-                            }
-                        }
+                    int mechIdx = GetNearestLocationOfType(&map, pPos2, LOC_MECHANIC);
+                    if (mechIdx != -1) {
+                        Vector2 mechPos = map.locations[mechIdx].position;
+                        respawnPoint = (Vector3){ mechPos.x, 0.5f, mechPos.y }; 
                     }
                     SaveGame(&player, &phone);
                 }
 
                 if (isDead) {
                     deathTimer += dt;
-                    if (deathTimer > 3.0f && IsKeyPressed(KEY_ENTER)) {
+                    if (deathTimer > 3.0f && ReplayKeyPressed(KEY_ENTER)) {
                         player.position = respawnPoint;
                         player.health = 100.0f;
                         player.current_speed = 0.0f;
                         player.fuel = player.maxFuel;
                         isDead = false;
+                        SnapPlayerState(&player);
                         ResetMapCamera((Vector2){player.position.x, player.position.z});
                     }
                 } 
                 else {
-                    if (phone.music.isPlaying && phone.music.songCount > 0) {
-                        UpdateMusicStream(phone.music.library[phone.music.currentSongIdx].stream);
-                    }
-                    
                     // --- NORMAL GAME LOOP ---
                     if (lockInput) {
                         // Apply friction to stop car if a window popped up while driving
@@ -212,8 +212,14 @@ int main(void)
                         if (player.current_speed < 0) player.current_speed = 0;
                     } 
                     else {
+                        PerfBegin(PERF_PLAYER);
                         UpdatePlayer(&player, &map, &traffic, dt);
+                        PerfEnd(PERF_PLAYER);
+                        PerfBegin(PERF_TRAFFIC);
+                        PROFILE_BEGIN("UpdateTraffic");
                         UpdateTraffic(&traffic, player.position, &map, dt);
+                        PROFILE_END();
+                        PerfEnd(PERF_TRAFFIC);
                         UpdateDevControls(&map, &player);
                     }
 
@@ -222,20 +228,25 @@ int main(void)
                     if (CheckInvisibleBorder(player.position, 1.0f, &pushVec)) {
                         player.position = Vector3Add(player.position, pushVec);
                         player.current_speed = 0.0f; 
+                        SnapPlayerState(&player);
                         SetIgnorePhysics();
                         borderMessageTimer = 2.0f; 
                     }
+                    PerfBegin(PERF_STREAMING);
                     UpdateMapStreaming(&map, player.position);
+                    PerfEnd(PERF_STREAMING);
                     UpdateVisuals(dt); 
-                    UpdateMapEffects(&map, player.position);
-                    UpdatePhone(&phone, &player, &map); 
-                    Update_Camera(player.position, &map, player.angle, dt);
+                    UpdateMapEffects(&map, player.position, dt);
+                    PerfBegin(PERF_PHONE);
+                    UpdatePhone(&phone, &player, &map, dt); 
+                    PerfEnd(PERF_PHONE);
+                    Update_Camera(player.renderPosition, &map, player.renderAngle, dt);
                     
                     // EMERGENCY FUEL LOGIC
                     if (player.fuel <= 0.0f) {
                         player.current_speed = Lerp(player.current_speed, 0.0f, 2.0f * dt); // Force stop
                         
-                        if (IsKeyPressed(KEY_R)) {
+                        if (ReplayKeyPressed(KEY_R)) {
                             float emergencyPricePerL = 4.50f; // 3x normal price
                             float emergencyAmount = 15.0f;    // Give 15 Liters
                             float totalCost = emergencyAmount * emergencyPricePerL;
@@ -261,28 +272,27 @@ int main(void)
                         }
                     }
 
-                    if (IsKeyPressed(KEY_F3)) isMechanicOpen = true;
+                    if (ReplayKeyPressed(KEY_F3)) isMechanicOpen = true;
 
                     // --- INTERACTION LOGIC ---
                     if (!isRefueling && !isMechanicOpen && fabs(player.current_speed) < 5.0f) {
-                        Vector2 playerPos2D = { player.position.x, player.position.z };
-                        for(int i = 0; i < map.locationCount; i++) {
-                            Vector2 locPos2D = { map.locations[i].position.x + 2.0f, map.locations[i].position.y + 2.0f };
-                            float dist = Vector2Distance(playerPos2D, locPos2D);
-
-                            if (dist < 6.0f) {
-                                if (map.locations[i].type == LOC_FUEL) {
-                                    if (IsKeyPressed(KEY_E)) {
-                                        isRefueling = true;
-                                    }
-                                }
-                                else if (map.locations[i].type == LOC_MECHANIC) {
-                                    if (IsKeyPressed(KEY_E)) isMechanicOpen = true;
-                                }
-                                else if (map.locations[i].type == LOC_DEALERSHIP && IsKeyPressed(KEY_E)) {
-                                    EnterDealership(&player);
+                        // Interaction points sit at +2,+2 from the location, so shift the probe instead
+                        Vector2 probePos = { player.position.x - 2.0f, player.position.z - 2.0f };
+                        int nearby[32];
+                        int nearbyCount = GetLocationsInRadius(&map, probePos, 6.0f, -1, nearby, 32);
+                        for(int n = 0; n < nearbyCount; n++) {
+                            int i = nearby[n];
+                            if (map.locations[i].type == LOC_FUEL) {
+                                if (ReplayKeyPressed(KEY_E)) {
+                                    isRefueling = true;
                                 }
                             }
+                            else if (map.locations[i].type == LOC_MECHANIC) {
+                                if (ReplayKeyPressed(KEY_E)) isMechanicOpen = true;
+                            }
+                            else if (map.locations[i].type == LOC_DEALERSHIP && ReplayKeyPressed(KEY_E)) {
+                                EnterDealership(&player);
+                            }
                         }
                     }
                 }
@@ -306,21 +316,21 @@ int main(void)
             else {
                 BeginMode3D(camera);
                     // DrawInvisibleBorders(); // for debugging border location
+                    PerfBegin(PERF_MAP_DRAW);
+                    PROFILE_BEGIN("DrawGameMap");
                     DrawGameMap(&map, camera);
+                    PROFILE_END();
+                    PerfEnd(PERF_MAP_DRAW);
                     
                     // Draw Deliveries
                     for(int i = 0; i < 5; i++) {
                         DeliveryTask *t = &phone.tasks[i];
 
                         if (t->status == JOB_ACCEPTED) {
-                            Vector3 rawPos = { t->restaurantPos.x, 0.0f, t->restaurantPos.y };
-                            Vector3 smartPos = GetSmartDeliveryPos(&map, rawPos);
-                            DrawZoneMarker(&map, camera, smartPos, LIME);
+                            DrawZoneMarker(&map, camera, GetDeliveryZonePos(t, &map), LIME);
                         }
                         else if (t->status == JOB_PICKED_UP) {
-                            Vector3 rawPos = { t->customerPos.x, 0.0f, t->customerPos.y };
-                            Vector3 smartPos = GetSmartDeliveryPos(&map, rawPos);
-                            DrawZoneMarker(&map, camera, smartPos, ORANGE);
+                            DrawZoneMarker(&map, camera, GetDeliveryZonePos(t, &map), ORANGE);
                         }
                     }
 
@@ -328,20 +338,18 @@ int main(void)
 
                     // Draw Interaction Markers
                     if (!isDead && !isRefueling && !isMechanicOpen) {
-                        Vector3 pPos3D = player.position;
-                        for(int i = 0; i < map.locationCount; i++) {
-                            Vector2 locPos2D = { map.locations[i].position.x + 2.0f, map.locations[i].position.y + 2.0f };
-                            Vector2 pPos2D = { pPos3D.x, pPos3D.z };
-                            
-                            if (Vector2Distance(pPos2D, locPos2D) < 144.0f) { 
-                                Vector3 labelPos = { locPos2D.x, 2.5f, locPos2D.y }; 
-                                if (map.locations[i].type == LOC_FUEL) DrawCube(labelPos, 0.5f, 0.5f, 0.5f, YELLOW); 
-                                else if (map.locations[i].type == LOC_MECHANIC) DrawCube(labelPos, 0.5f, 0.5f, 0.5f, BLUE); 
-                            }
+                        Vector2 probePos = { player.position.x - 2.0f, player.position.z - 2.0f };
+                        int markers[64];
+                        int fuelCount = GetLocationsInRadius(&map, probePos, 144.0f, LOC_FUEL, markers, 64);
+                        int markerCount = fuelCount + GetLocationsInRadius(&map, probePos, 144.0f, LOC_MECHANIC, markers + fuelCount, 64 - fuelCount);
+                        for(int n = 0; n < markerCount; n++) {
+                            Vector2 locPos = map.locations[markers[n]].position;
+                            Vector3 labelPos = { locPos.x + 2.0f, 2.5f, locPos.y + 2.0f }; 
+                            DrawCube(labelPos, 0.5f, 0.5f, 0.5f, (n < fuelCount) ? YELLOW : BLUE); 
                         }
                     }
                     
-                    DrawModelEx(player.model, player.position, (Vector3){0.0f, 1.0f, 0.0f}, player.angle, (Vector3){0.35f, 0.35f, 0.35f}, WHITE);
+                    DrawModelEx(player.model, player.renderPosition, (Vector3){0.0f, 1.0f, 0.0f}, player.renderAngle, (Vector3){0.35f, 0.35f, 0.35f}, WHITE);
                     DrawTraffic(&traffic);
                 EndMode3D();
                 
@@ -367,6 +375,7 @@ int main(void)
                 }
 
                 // 2D Drawing Loop
+                PerfBegin(PERF_UI);
                 if (borderMessageTimer > 0.0f) {
                     borderMessageTimer -= GetFrameTime();
                     
@@ -475,7 +484,11 @@ int main(void)
                         isMechanicOpen = DrawMechanicWindow(&player, &phone, isMechanicOpen, GetScreenWidth(), GetScreenHeight());
                     }
                     else {
+                        PerfBegin(PERF_PHONE);
+                        PROFILE_BEGIN("DrawPhone");
                         DrawPhone(&phone, &player, &map, mousePos, isClick);
+                        PROFILE_END();
+                        PerfEnd(PERF_PHONE);
                         if (!phone.isOpen) { 
                             DrawText("Press TAB to open Phone", GetScreenWidth() - 273, GetScreenHeight() - 30, 20, DARKGRAY);
                         }
@@ -494,23 +507,39 @@ int main(void)
                 
                 // Tutorial Overlay
                 DrawTutorial(&player, &phone, isRefueling);
+                PerfEnd(PERF_UI);
+                DrawPerfOverlay();
+                DrawReplayIndicator();
             }
 
             if (isLoading) {
                 // Returns false when bar hits 100%
-                isLoading = DrawPostLoadOverlay(GetScreenWidth(), GetScreenHeight(), dt);
+                isLoading = DrawPostLoadOverlay(GetScreenWidth(), GetScreenHeight(), (float)frameCounter / (float)WARMUP_FRAMES);
             }
+            PerfBegin(PERF_PRESENT);
             EndDrawing();
+            PerfEnd(PERF_PRESENT);
+            PerfEndFrame();
+            PROFILE_END();
         }
 
         if (player.health > 0) SaveGame(&player, &phone);
+        FlushSaves();
+        BindSaveWorld(NULL, NULL);
         
         UnloadModel(player.model);
         UnloadGameMap(&map);
+        UnloadTraffic(&traffic);
         UnloadPhone(&phone);
+        UnloadPerfOverlay();
+        StopReplay();
         UnloadDealershipSystem(); 
     }
     
+    UnloadTrafficRenderer();
+    UnloadAssetCache();
+    StopMusicPlayer();
+    ShutdownThreadPool();
     CloseAudioDevice();
     CloseWindow();
     return 0;
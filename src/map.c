@@ -33,6 +33,10 @@
 #include "map.h"
 #include "raymath.h"
 #include "rlgl.h"
+#include "perf_overlay.h"
+#include "profiler.h"
+#include "asset_cache.h"
+#include "thread_pool.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -57,8 +61,18 @@ typedef struct {
     int *areaIndices;
     int areaCount;
     int areaCap;
+    int *locationIndices;
+    int locationCount;
+    int locationCap;
 } SectorManifest;
 
+// [OPTIMIZATION] Road-snapped transform of a MapLocation, computed once at load
+typedef struct {
+    Vector3 drawPos;    // Prop position (road edge + 5m)
+    float rotAngle;     // Facing the road, degrees
+    Vector3 labelPos;   // Interaction label anchor (road edge + 4m)
+} LocationPlacement;
+
 // --- MAP BOUNDARIES (Dead Ends) ---
 typedef struct {
     Vector3 position;
@@ -112,6 +126,7 @@ typedef struct {
 
 static CollisionCell colGrid[SECTOR_GRID_ROWS][SECTOR_GRID_COLS] = {0};
 static NodeCell nodeGrid[SECTOR_GRID_ROWS][SECTOR_GRID_COLS] = {0}; 
+static NodeCell locationTypeLists[LOC_COUNT] = {0}; // Location indices grouped by LocationType
 static bool colGridLoaded = false;
 
 typedef enum {
@@ -158,6 +173,12 @@ typedef struct {
     AssetType balcony; bool hasAC; bool isSkyscraper; bool isWhiteTheme;
 } BuildingStyle;
 
+// Counter-based random stream for bake-time generation (see MakeBakeRng)
+typedef struct {
+    unsigned int key;       // Hash of map seed + stream + object/sector coordinates
+    unsigned int counter;   // Draw index; value n is a pure function of (key, n)
+} BakeRng;
+
 // [OPTIMIZATION] Sector Builder for Static Mesh Baking
 typedef struct {
     float *vertices;   // 3 floats per vertex
@@ -192,6 +213,7 @@ typedef struct {
     int activeSectorCount;
 
     int *nodeDegrees;
+    LocationPlacement *locationPlacements;
     bool loaded;
     Texture2D whiteTex;
     Texture2D sharedAtlas; 
@@ -220,9 +242,16 @@ typedef struct {
 static CityRenderSystem cityRenderer = {0};
 static SectorBuilder *currentActiveBuilder = NULL;
 
+// Headless mode (benchmark harness): no GPU assets, sector bakes stop before the upload
+static bool mapHeadless = false;
+
 // [OPTIMIZATION] Persistent Memory Buffers
 // Allocated ONCE at startup to reduce malloc overhead
 static SectorBuilder globalSectorBuilder = {0}; 
+
+// Set while the loader thread bakes the starting zone: each sector bakes into its own
+// cityRenderer.builders[y][x] and stops before the GPU upload (FinishMapLoad does it)
+static bool deferSectorUploads = false;
 static int globalTempIndices[4096]; 
 
 Color cityPalette[] = {
@@ -233,7 +262,7 @@ Color cityPalette[] = {
 // --- FORWARD DECLARATIONS ---
 bool IsPointNearSegment(Vector2 p, Vector2 a, Vector2 b, float threshold); 
 bool IsInsideCityContext(GameMap *map, Vector2 pos);
-void BakeBuildingGeometry(Building *b);
+void BakeBuildingGeometry(GameMap *map, Building *b);
 void BakeSingleEdgeDetails(GameMap *map, int edgeIdx);
 void BakeObjectToSector(AssetType assetType, Vector3 pos, float rot, Vector3 scale, Color tint);
 void InitSectorBuilder(SectorBuilder *sb);
@@ -241,12 +270,25 @@ void FreeSectorBuilder(SectorBuilder *sb);
 Model BakeSectorMesh(SectorBuilder *sb);
 void PushSectorTri(SectorBuilder *sb, Vector3 v1, Vector3 v2, Vector3 v3, Vector3 n1, Vector3 n2, Vector3 n3, Vector2 uv1, Vector2 uv2, Vector2 uv3, Color c);
 void BakeSignWithLegs(Model signModel, Vector3 pos, float angleDeg);
-BuildingStyle GetBuildingStyle(Vector2 pos);
+BuildingStyle GetBuildingStyle(Vector2 pos, BakeRng *rng);
 float GetRaySegmentIntersection(Vector2 rayOrigin, Vector2 rayDir, Vector2 p1, Vector2 p2);
 bool IsTooCloseToBuilding(GameMap *map, Vector2 pos, float minDistance);
+void UnloadMap2DTiles(void);
 
 // --- HELPER FUNCTIONS ---
 
+/*
+ * Description: Switches the map module to headless mode. Must be called before LoadGameMap.
+ * City assets are not loaded and streamed sectors run every CPU bake stage but skip the
+ * GPU upload, so the map can be simulated without a window or GL context.
+ * Parameters:
+ * - headless: True to disable all GPU work.
+ * Returns: None.
+ */
+void SetMapHeadless(bool headless) {
+    mapHeadless = headless;
+}
+
 // --- INVISIBLE BORDER SYSTEM ---
 
 typedef struct { Vector2 start; Vector2 end; } MapBoundaryLine;
@@ -606,6 +648,21 @@ void BuildCollisionGrid(GameMap *map) {
     printf("Collision Grid Built.\n");
 }
 
+/*
+ * Description: Frees the building collision grid so BuildCollisionGrid can run again.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ClearCollisionGrid(void) {
+    for(int y = 0; y < SECTOR_GRID_ROWS; y++) {
+        for(int x = 0; x < SECTOR_GRID_COLS; x++) {
+            if (colGrid[y][x].indices) free(colGrid[y][x].indices);
+            colGrid[y][x] = (CollisionCell){0};
+        }
+    }
+    colGridLoaded = false;
+}
+
 // --- MANIFEST SYSTEMS ---
 
 /*
@@ -635,6 +692,33 @@ void AddToManifest(SectorManifest *man, int index, int type) {
             man->areaIndices = realloc(man->areaIndices, man->areaCap * sizeof(int));
         }
         man->areaIndices[man->areaCount++] = index;
+    } else if (type == 3) {
+        if (man->locationCount >= man->locationCap) {
+            man->locationCap = (man->locationCap == 0) ? 4 : man->locationCap * 2;
+            man->locationIndices = realloc(man->locationIndices, man->locationCap * sizeof(int));
+        }
+        man->locationIndices[man->locationCount++] = index;
+    }
+}
+
+/*
+ * Description: Frees every sector manifest (object index lists per grid cell).
+ * Parameters: None.
+ * Returns: None.
+ */
+void ClearSectorManifests(void) {
+    for (int y = 0; y < SECTOR_GRID_ROWS; y++) {
+        for (int x = 0; x < SECTOR_GRID_COLS; x++) {
+            SectorManifest *man = &cityRenderer.manifests[y][x];
+            if (man->buildingIndices) { free(man->buildingIndices); man->buildingIndices = NULL; }
+            if (man->edgeIndices) { free(man->edgeIndices); man->edgeIndices = NULL; }
+            if (man->areaIndices) { free(man->areaIndices); man->areaIndices = NULL; }
+            if (man->locationIndices) { free(man->locationIndices); man->locationIndices = NULL; }
+            man->buildingCount = 0; man->buildingCap = 0;
+            man->edgeCount = 0; man->edgeCap = 0;
+            man->areaCount = 0; man->areaCap = 0;
+            man->locationCount = 0; man->locationCap = 0;
+        }
     }
 }
 
@@ -708,6 +792,66 @@ void BuildSectorManifests(GameMap *map) {
     }
 }
 
+/*
+ * Description: Snaps every location to the side of its nearest road once, and buckets it into its sector.
+ * Needs the node grid and navigation graph, so it runs after BuildNodeGrid/BuildMapGraph.
+ * Parameters:
+ * - map: Pointer to the GameMap.
+ * Returns: None.
+ */
+void BuildLocationPlacements(GameMap *map) {
+    if (cityRenderer.locationPlacements) free(cityRenderer.locationPlacements);
+    for (int t = 0; t < LOC_COUNT; t++) locationTypeLists[t].count = 0;
+    cityRenderer.locationPlacements = (LocationPlacement*)calloc(map->locationCount > 0 ? map->locationCount : 1, sizeof(LocationPlacement));
+
+    for (int i = 0; i < map->locationCount; i++) {
+        Vector2 locPos = map->locations[i].position;
+        LocationPlacement *lp = &cityRenderer.locationPlacements[i];
+        lp->drawPos = (Vector3){ locPos.x, 0.0f, locPos.y };
+        lp->labelPos = (Vector3){ locPos.x, 0.9f, locPos.y };
+        lp->rotAngle = 0.0f;
+
+        int nodeIdx = GetClosestNode(map, locPos);
+        if (nodeIdx != -1 && map->graph && map->graph[nodeIdx].count > 0) {
+            int edgeIdx = map->graph[nodeIdx].connections[0].edgeIndex;
+            Edge e = map->edges[edgeIdx];
+            Vector2 p1 = map->nodes[e.startNode].position;
+            Vector2 p2 = map->nodes[e.endNode].position;
+            
+            Vector2 roadDir = Vector2Normalize(Vector2Subtract(p2, p1));
+            Vector2 roadNormal = { -roadDir.y, roadDir.x }; 
+            
+            Vector2 toPoint = Vector2Subtract(locPos, p1);
+            if (Vector2DotProduct(toPoint, roadNormal) < 0) roadNormal = Vector2Negate(roadNormal);
+            
+            float t = Vector2DotProduct(toPoint, roadDir);
+            Vector2 centerOnRoad = Vector2Add(p1, Vector2Scale(roadDir, t));
+            
+            Vector2 drawPos = Vector2Add(centerOnRoad, Vector2Scale(roadNormal, (e.width * MAP_SCALE) + 5.0f));
+            Vector2 labelPos = Vector2Add(centerOnRoad, Vector2Scale(roadNormal, (e.width * MAP_SCALE) + 4.0f));
+            lp->drawPos = (Vector3){ drawPos.x, 0.0f, drawPos.y };
+            lp->labelPos = (Vector3){ labelPos.x, 0.9f, labelPos.y };
+            lp->rotAngle = atan2f(-roadNormal.x, -roadNormal.y) * RAD2DEG;
+        }
+
+        int gx = (int)((locPos.x + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+        int gy = (int)((locPos.y + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+        if (gx >= 0 && gx < SECTOR_GRID_COLS && gy >= 0 && gy < SECTOR_GRID_ROWS) {
+            AddToManifest(&cityRenderer.manifests[gy][gx], i, 3);
+        }
+
+        int type = map->locations[i].type;
+        if (type >= 0 && type < LOC_COUNT) {
+            NodeCell *list = &locationTypeLists[type];
+            if (list->count >= list->capacity) {
+                list->capacity = (list->capacity == 0) ? 8 : list->capacity * 2;
+                list->indices = realloc(list->indices, list->capacity * sizeof(int));
+            }
+            list->indices[list->count++] = i;
+        }
+    }
+}
+
 /*
  * Description: Triangulates a simple polygon using the Ear Clipping algorithm.
  * Parameters:
@@ -1054,6 +1198,69 @@ unsigned int GetSpatialHash(Vector3 pos) {
     return x ^ z;
 }
 
+// --- BAKE-TIME RANDOMNESS ---
+// Sector bakes never touch the global raylib RNG. Every object draws from its own stream,
+// keyed by the map hash (GameMap.seed) and its position or sector, so re-streaming a sector
+// rebuilds the same geometry on any thread, in any order.
+#define BAKE_STREAM_BUILDING   1u
+#define BAKE_STREAM_VEGETATION 2u
+#define BAKE_STREAM_ROAD_PROPS 3u
+
+/*
+ * Description: 32-bit integer finalizer (full avalanche), the core of the bake RNG.
+ * Parameters:
+ * - x: Input value.
+ * Returns: Mixed value.
+ */
+static unsigned int HashMix32(unsigned int x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+static unsigned int HashCombine(unsigned int h, unsigned int v) {
+    return HashMix32(h ^ (v + 0x9e3779b9u + (h << 6) + (h >> 2)));
+}
+
+static unsigned int HashFloatBits(float f) {
+    unsigned int bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+/*
+ * Description: Creates the random stream for one baked object or sector.
+ * Parameters:
+ * - seed: Map hash (GameMap.seed).
+ * - stream: BAKE_STREAM_* id, so different generators never share values.
+ * - a, b: Object coordinates (sector x/y, position bits, sample index...).
+ * Returns: A stream starting at draw 0.
+ */
+static BakeRng MakeBakeRng(unsigned int seed, unsigned int stream, unsigned int a, unsigned int b) {
+    BakeRng rng = { HashCombine(HashCombine(HashCombine(seed, stream), a), b), 0 };
+    return rng;
+}
+
+static unsigned int NextBakeRandom(BakeRng *rng) {
+    return HashMix32(rng->key ^ HashMix32(rng->counter++ * 0x9e3779b9u + 1u));
+}
+
+/*
+ * Description: Bake-time replacement for GetRandomValue.
+ * Parameters:
+ * - rng: Stream to draw from.
+ * - min, max: Inclusive range.
+ * Returns: Value in [min, max].
+ */
+static int BakeRandomRange(BakeRng *rng, int min, int max) {
+    if (max < min) { int t = min; min = max; max = t; }
+    unsigned int span = (unsigned int)(max - min) + 1u;
+    return min + (int)(NextBakeRandom(rng) % span);
+}
+
 /*
  * Description: Generates a rounded geometry cap at road nodes to smooth connections.
  * Parameters:
@@ -1334,13 +1541,17 @@ void GenerateSectorVegetation(GameMap *map, int gx, int gy) {
     Color flowerTint = (Color){200, 200, 200, 255};
 
     SectorManifest *man = &cityRenderer.manifests[gy][gx];
+    BakeRng sectorRng = MakeBakeRng(map->seed, BAKE_STREAM_VEGETATION, (unsigned int)gx, (unsigned int)gy);
+    unsigned int sample = 0;
 
     for (float py = startY; py < startY + GRID_CELL_SIZE; py += step) {
         for (float px = startX; px < startX + GRID_CELL_SIZE; px += step) {
-            
+            // One stream per sample point: independent of which earlier points were rejected
+            BakeRng rng = MakeBakeRng(sectorRng.key, BAKE_STREAM_VEGETATION, sample++, 0);
+
             // 1. Jitter
-            float jx = px + GetRandomValue(-15, 15) / 10.0f;
-            float jy = py + GetRandomValue(-15, 15) / 10.0f;
+            float jx = px + BakeRandomRange(&rng, -15, 15) / 10.0f;
+            float jy = py + BakeRandomRange(&rng, -15, 15) / 10.0f;
             Vector2 pos = {jx, jy};
 
             // 2. "Sea" Check (Context)
@@ -1373,8 +1584,8 @@ void GenerateSectorVegetation(GameMap *map, int gx, int gy) {
 
             // 5. Spawn Logic
             Vector3 spawnPos = {jx, 0.0f, jy}; 
-            int roll = GetRandomValue(0, 100);
-            int rot = GetRandomValue(0, 360);
+            int roll = BakeRandomRange(&rng, 0, 100);
+            int rot = BakeRandomRange(&rng, 0, 360);
 
             if (roll < 5) { 
                 BakeObjectToSector(ASSET_PROP_TREE_LARGE, spawnPos, rot, (Vector3){6.5f, 6.5f, 6.5f}, treeTint);
@@ -1398,6 +1609,77 @@ void GenerateSectorVegetation(GameMap *map, int gx, int gy) {
 // Tracks where we left off inside a specific list (e.g., building #12)
 static int globalLoadIterator = 0;
 
+/*
+ * Description: Final sector stage: uploads the baked geometry and adds the sector to the active list.
+ *              Main thread only (GPU).
+ * Parameters:
+ * - x, y: Sector grid coordinates.
+ * - sb: Builder holding the sector's baked geometry.
+ * Returns: None.
+ */
+static void CompleteSectorUpload(int x, int y, SectorBuilder *sb) {
+    Sector *sec = &cityRenderer.sectors[y][x];
+
+    if (sb->vertexCount > 0 && !mapHeadless) {
+        sec->model = BakeSectorMesh(sb);
+        if (cityRenderer.whiteTex.id != 0) {
+            for(int m = 0; m < sec->model.meshCount; m++) {
+                sec->model.materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = cityRenderer.whiteTex;
+            }
+        }
+        sec->isEmpty = false;
+    } else {
+        sec->isEmpty = true;
+    }
+    
+    sec->active = true;
+    sec->activeListIndex = cityRenderer.activeSectorCount;
+    cityRenderer.activeSectors[cityRenderer.activeSectorCount].x = x;
+    cityRenderer.activeSectors[cityRenderer.activeSectorCount].y = y;
+    cityRenderer.activeSectorCount++;
+    
+    sec->loadStage = 5; // Done
+}
+
+/*
+ * Description: Queues a sector for loading. ProcessSectorLoadStep then advances it one stage slice per call.
+ * Parameters:
+ * - x, y: Sector grid coordinates.
+ * Returns: None.
+ */
+void BeginSectorLoad(int x, int y) {
+    cityRenderer.loadingSectorX = x;
+    cityRenderer.loadingSectorY = y;
+    cityRenderer.isSectorLoading = true;
+    cityRenderer.sectors[y][x].loadStage = 0;
+}
+
+/*
+ * Description: Converts a world position to sector grid coordinates.
+ * Parameters:
+ * - worldPos: 2D world position (x, z).
+ * - outX, outY: Out, sector coordinates.
+ * Returns: False if the position is outside the sector grid.
+ */
+bool GetSectorAt(Vector2 worldPos, int *outX, int *outY) {
+    int x = (int)((worldPos.x + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    int y = (int)((worldPos.y + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    if (x < 0 || x >= SECTOR_GRID_COLS || y < 0 || y >= SECTOR_GRID_ROWS) return false;
+    *outX = x;
+    *outY = y;
+    return true;
+}
+
+/*
+ * Description: Returns the pipeline stage a sector is at (0-4 loading, 5 done).
+ * Parameters:
+ * - x, y: Sector grid coordinates.
+ * Returns: The load stage.
+ */
+int GetSectorLoadStage(int x, int y) {
+    return cityRenderer.sectors[y][x].loadStage;
+}
+
 /*
  * Description: Processes a single step of the sector loading pipeline (distributed over frames).
  * Parameters:
@@ -1410,27 +1692,30 @@ bool ProcessSectorLoadStep(GameMap *map) {
     int x = cityRenderer.loadingSectorX;
     int y = cityRenderer.loadingSectorY;
     Sector *sec = &cityRenderer.sectors[y][x];
-    SectorBuilder *sb = &globalSectorBuilder;
+    SectorBuilder *sb = deferSectorUploads ? cityRenderer.builders[y][x] : &globalSectorBuilder;
     currentActiveBuilder = sb; 
 
     SectorManifest *man = &cityRenderer.manifests[y][x];
 
     // --- STAGE 0: SETUP ---
     if (sec->loadStage == 0) {
+        PROFILE_BEGIN("Sector Stage 0: Setup");
         if (sb->capacity == 0) InitSectorBuilder(sb);
         sb->vertexCount = 0; 
         sec->loadStage = 1;
         globalLoadIterator = 0;
+        PROFILE_END();
         return true; 
     }
 
     // --- STAGE 1: BUILDINGS ---
     if (sec->loadStage == 1) {
+        PROFILE_BEGIN("Sector Stage 1: Buildings");
         int batchSize = 5; 
         int processed = 0;
 
         while (processed < batchSize && globalLoadIterator < man->buildingCount) {
-            BakeBuildingGeometry(&map->buildings[man->buildingIndices[globalLoadIterator]]);
+            BakeBuildingGeometry(map, &map->buildings[man->buildingIndices[globalLoadIterator]]);
             globalLoadIterator++;
             processed++;
         }
@@ -1439,11 +1724,13 @@ bool ProcessSectorLoadStep(GameMap *map) {
             sec->loadStage = 2; // Go to Roads
             globalLoadIterator = 0;
         }
+        PROFILE_END();
         return true; 
     }
 
     // --- STAGE 2: ROADS ---
     if (sec->loadStage == 2) {
+        PROFILE_BEGIN("Sector Stage 2: Roads");
         int batchSize = 10;
         int processed = 0;
 
@@ -1457,39 +1744,30 @@ bool ProcessSectorLoadStep(GameMap *map) {
             sec->loadStage = 3; 
             globalLoadIterator = 0; 
         }
+        PROFILE_END();
         return true;
     }
 
     // --- STAGE 3: GLOBAL VEGETATION ---
     if (sec->loadStage == 3) {
+        PROFILE_BEGIN("Sector Stage 3: Vegetation");
         GenerateSectorVegetation(map, x, y);
         sec->loadStage = 4; // Go to Upload
+        PROFILE_END();
         return true;
     }
 
     // --- STAGE 4: GPU UPLOAD ---
     if (sec->loadStage == 4) {
-        if (sb->vertexCount > 0) {
-            sec->model = BakeSectorMesh(sb);
-            if (cityRenderer.whiteTex.id != 0) {
-                for(int m = 0; m < sec->model.meshCount; m++) {
-                    sec->model.materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = cityRenderer.whiteTex;
-                }
-            }
-            sec->isEmpty = false;
-        } else {
-            sec->isEmpty = true;
-        }
-        
-        sec->active = true;
-        sec->activeListIndex = cityRenderer.activeSectorCount;
-        cityRenderer.activeSectors[cityRenderer.activeSectorCount].x = x;
-        cityRenderer.activeSectors[cityRenderer.activeSectorCount].y = y;
-        cityRenderer.activeSectorCount++;
-        
-        sec->loadStage = 5; // Done
         cityRenderer.isSectorLoading = false; 
         currentActiveBuilder = NULL;
+
+        // Loader thread: leave the sector at stage 4, the main thread uploads it later
+        if (deferSectorUploads) return false;
+
+        PROFILE_BEGIN("Sector Stage 4: Upload");
+        CompleteSectorUpload(x, y, sb);
+        PROFILE_END();
         return false; // Finished!
     }
 
@@ -1593,12 +1871,7 @@ void UpdateMapStreaming(GameMap *map, Vector3 playerPos) {
                 if (!cityRenderer.sectors[y][x].active && !cityRenderer.isSectorLoading) {
                     
                     // Found a candidate
-                    cityRenderer.loadingSectorX = x;
-                    cityRenderer.loadingSectorY = y;
-                    cityRenderer.isSectorLoading = true;
-                    
-                    cityRenderer.sectors[y][x].loadStage = 0;
-                    
+                    BeginSectorLoad(x, y);
                     ProcessSectorLoadStep(map);
                     return; 
                 }
@@ -1729,17 +2002,21 @@ float GetRaySegmentIntersection(Vector2 rayOrigin, Vector2 rayDir, Vector2 p1, V
 
 /*
  * Description: Creates a visual mesh for the building based on its style and dimensions.
+ * Style and AC units come from a stream keyed by the building's first corner, so every bake of
+ * the same building is identical (b->height is snapped to whole floors on the first one).
  * Parameters:
+ * - map: Pointer to the GameMap (seed).
  * - b: Pointer to the Building struct.
  * Returns: None.
  */
-void BakeBuildingGeometry(Building *b) {
+void BakeBuildingGeometry(GameMap *map, Building *b) {
     float floorHeight = 3.0f * (MODEL_SCALE / 4.0f); 
     Vector2 bCenter = GetBuildingCenter(b->footprint, b->pointCount);
-    BuildingStyle style = GetBuildingStyle(bCenter);
+    BakeRng rng = MakeBakeRng(map->seed, BAKE_STREAM_BUILDING, HashFloatBits(b->footprint[0].x), HashFloatBits(b->footprint[0].y));
+    BuildingStyle style = GetBuildingStyle(bCenter, &rng);
     
     if (style.isSkyscraper) floorHeight *= 0.85f; 
-    int rawFloors = (int)(b->height / floorHeight);
+    int rawFloors = (int)(b->height / floorHeight + 0.001f); // Epsilon: a re-bake must not lose the floor it snapped to
     if (style.isSkyscraper) { if (rawFloors < 6) rawFloors = 6; } 
     else { if (rawFloors < 2) rawFloors = 2; if (rawFloors > 5) rawFloors = 5; }
     
@@ -1812,8 +2089,8 @@ void BakeBuildingGeometry(Building *b) {
                     AssetType winType = (f == floors - 1) ? style.windowTop : style.window;
                     BakeObjectToSector(winType, pos, modelRotation, winScale, tint);
                     
-                    if (f < floors-1 && GetRandomValue(0, 100) < 15) {
-                        AssetType acType = (GetRandomValue(0, 1) == 0) ? ASSET_AC_A : ASSET_AC_B;
+                    if (f < floors-1 && BakeRandomRange(&rng, 0, 100) < 15) {
+                        AssetType acType = (BakeRandomRange(&rng, 0, 1) == 0) ? ASSET_AC_A : ASSET_AC_B;
                         Vector3 acPos = { pos.x, pos.y - 0.4f, pos.z }; 
                         Vector3 acScale = { MODEL_SCALE, MODEL_SCALE, structuralDepth };
                         BakeObjectToSector(acType, acPos, modelRotation, acScale, tint);
@@ -2049,13 +2326,14 @@ Model GenerateSignModel(const char* text, Color bgCol, Color textCol) {
  * Description: Selects a building style (Skyscraper, House, Shop) based on location and randomness.
  * Parameters:
  * - pos: The world position of the building.
+ * - rng: The building's bake stream.
  * Returns: A BuildingStyle struct.
  */
-BuildingStyle GetBuildingStyle(Vector2 pos) {
+BuildingStyle GetBuildingStyle(Vector2 pos, BakeRng *rng) {
     BuildingStyle style = {0};
     float distToCenter = Vector2Length(pos);
     bool isCenter = (distToCenter < REGION_CENTER_RADIUS);
-    int roll = GetRandomValue(0, 100);
+    int roll = BakeRandomRange(rng, 0, 100);
     
     if (isCenter && roll < 60) {
         style.isSkyscraper = true; style.window = ASSET_WIN_TALL; style.windowTop = ASSET_WIN_TALL_TOP;
@@ -2120,79 +2398,122 @@ void BakeSignWithLegs(Model signModel, Vector3 pos, float angleDeg) {
     BakeObjectToSector(ASSET_WALL, rPos, angleDeg, legScale, legColor);
 }
 
+// [OPTIMIZATION] All OBJ assets are decoded as one batch (binary mesh cache, shared textures)
+// instead of one blocking LoadModel() each.
+typedef struct { AssetType type; const char *path; } AssetFile;
+static const AssetFile cityAssetFiles[] = {
+    // --- Buildings ---
+    { ASSET_AC_A, "resources/Buildings/detail-ac-a.obj" },
+    { ASSET_AC_B, "resources/Buildings/detail-ac-b.obj" },
+    { ASSET_DOOR_BROWN, "resources/Buildings/door-brown.obj" },
+    { ASSET_DOOR_BROWN_GLASS, "resources/Buildings/door-brown-glass.obj" },
+    { ASSET_DOOR_BROWN_WIN, "resources/Buildings/door-brown-window.obj" },
+    { ASSET_DOOR_WHITE, "resources/Buildings/door-white.obj" },
+    { ASSET_DOOR_WHITE_GLASS, "resources/Buildings/door-white-glass.obj" },
+    { ASSET_DOOR_WHITE_WIN, "resources/Buildings/door-white-window.obj" },
+    { ASSET_FRAME_DOOR1, "resources/Buildings/door1.obj" },
+    { ASSET_FRAME_SIMPLE, "resources/Buildings/simple_door.obj" },
+    { ASSET_FRAME_TENT, "resources/Buildings/doorframe_glass_tent.obj" },
+    { ASSET_FRAME_WIN, "resources/Buildings/window_door.obj" },
+    { ASSET_FRAME_WIN_WHITE, "resources/Buildings/window_door_white.obj" },
+    { ASSET_WIN_SIMPLE, "resources/Buildings/Windows_simple.obj" },
+    { ASSET_WIN_SIMPLE_W, "resources/Buildings/Windows_simple_white.obj" },
+    { ASSET_WIN_DET, "resources/Buildings/Windows_detailed.obj" },
+    { ASSET_WIN_DET_W, "resources/Buildings/Windows_detailed_white.obj" },
+    { ASSET_WIN_TWIN_TENT, "resources/Buildings/Twin_window_tents.obj" },
+    { ASSET_WIN_TWIN_TENT_W, "resources/Buildings/Twin_window_tents_white.obj" },
+    { ASSET_WIN_TALL, "resources/Buildings/windows_tall.obj" },
+    { ASSET_WIN_TALL_TOP, "resources/Buildings/windows_tall_top.obj" },
+    // --- Props & Vegetation ---
+    { ASSET_PROP_TREE_LARGE, "resources/trees/tree-large.obj" },
+    { ASSET_PROP_TREE_SMALL, "resources/trees/tree-small.obj" },
+    { ASSET_PROP_BENCH, "resources/random/bench.obj" },
+    { ASSET_PROP_FLOWERS, "resources/random/flowers.obj" },
+    { ASSET_PROP_GRASS, "resources/random/grass.obj" },
+    { ASSET_PROP_TRASH, "resources/random/trash.obj" },
+    { ASSET_PROP_BOX, "resources/Props/box.obj" },
+    { ASSET_PROP_CONE, "resources/Props/cone.obj" },
+    { ASSET_PROP_CONE_FLAT, "resources/Props/cone-flat.obj" },
+    { ASSET_PROP_BARRIER, "resources/Props/construction-barrier.obj" },
+    { ASSET_PROP_CONST_LIGHT, "resources/Props/construction-light.obj" },
+    { ASSET_PROP_LIGHT_CURVED, "resources/Props/light-curved.obj" },
+    // --- Vehicles ---
+    { ASSET_CAR_DELIVERY, "resources/Playermodels/delivery.obj" },
+    { ASSET_CAR_HATCHBACK, "resources/Playermodels/hatchback-sports.obj" },
+    { ASSET_CAR_SEDAN, "resources/Playermodels/sedan.obj" },
+    { ASSET_CAR_SUV, "resources/Playermodels/suv.obj" },
+    { ASSET_CAR_VAN, "resources/Playermodels/van.obj" },
+    { ASSET_CAR_POLICE, "resources/Playermodels/police.obj" },
+};
+#define CITY_ASSET_FILE_COUNT ((int)(sizeof(cityAssetFiles) / sizeof(cityAssetFiles[0])))
+
+// Extra models (locations, barrier override) ride along in the same batch
+enum { EXTRA_MECHANIC, EXTRA_FUEL, EXTRA_DEALERSHIP, EXTRA_BARRIER, EXTRA_COUNT };
+static const char *cityExtraFiles[EXTRA_COUNT] = {
+    "resources/locations/pitsGarageClosed.obj",
+    "resources/locations/pitsGarageCorner.obj",
+    "resources/locations/pitsOffice.obj",
+    "resources/locations/barrierWhite.obj",
+};
+
+#define CITY_ATLAS_PATH "resources/Buildings/Textures/colormap.png"
+
+// City assets decoded off the main thread, waiting for UploadCityAssets
+typedef struct {
+    ModelBatch *batch;
+    Image atlas;
+} CityAssetData;
+
 /*
- * Description: Loads all 3D assets, textures, and models required for city rendering.
+ * Description: CPU half of the city asset load: decodes the model batch and the atlas image.
+ *              Safe to call from the map loader thread.
  * Parameters: None.
+ * Returns: Decoded data for UploadCityAssets.
+ */
+static CityAssetData DecodeCityAssets(void) {
+    CityAssetData data = { 0 };
+    if (FileExists(CITY_ATLAS_PATH)) data.atlas = LoadImage(CITY_ATLAS_PATH);
+
+    const char *batchPaths[CITY_ASSET_FILE_COUNT + EXTRA_COUNT];
+    for (int i = 0; i < CITY_ASSET_FILE_COUNT; i++) batchPaths[i] = cityAssetFiles[i].path;
+    for (int i = 0; i < EXTRA_COUNT; i++) batchPaths[CITY_ASSET_FILE_COUNT + i] = cityExtraFiles[i];
+
+    data.batch = DecodeModelBatch(batchPaths, CITY_ASSET_FILE_COUNT + EXTRA_COUNT);
+    return data;
+}
+
+/*
+ * Description: GPU half of the city asset load (main thread only): uploads the decoded batch and atlas,
+ *              then builds the procedural models and fixes up the tintable props.
+ * Parameters:
+ * - data: Output of DecodeCityAssets. Ownership of the batch and image moves here.
  * Returns: None.
  */
-void LoadCityAssets() {
-    if (cityRenderer.loaded) return;
-    
+static void UploadCityAssets(CityAssetData *data) {
     // --- 1. Load the Atlas ---
-    if (FileExists("resources/Buildings/Textures/colormap.png")) {
-        cityRenderer.whiteTex = LoadTexture("resources/Buildings/Textures/colormap.png");
+    if (data->atlas.data) {
+        cityRenderer.whiteTex = LoadTextureFromImage(data->atlas);
+        UnloadImage(data->atlas);
         SetTextureFilter(cityRenderer.whiteTex, TEXTURE_FILTER_BILINEAR); 
     } else {
         Image whiteImg = GenImageColor(1, 1, WHITE);
         cityRenderer.whiteTex = LoadTextureFromImage(whiteImg);
         UnloadImage(whiteImg);
     }
-
-    // Helper macro
-    #define LOAD_ASSET(enumIdx, path) \
-        { \
-            cityRenderer.models[enumIdx] = LoadModel(path); \
-            if (cityRenderer.models[enumIdx].meshCount == 0) { \
-                printf("Failed to load: %s\n", path); \
-                cityRenderer.models[enumIdx] = LoadModelFromMesh(GenMeshCube(1.0f, 1.0f, 1.0f)); \
-            } \
+    data->atlas = (Image){ 0 };
+
+    int assetFileCount = CITY_ASSET_FILE_COUNT;
+    Model batchModels[CITY_ASSET_FILE_COUNT + EXTRA_COUNT] = { 0 };
+    UploadModelBatch(data->batch, batchModels);
+    data->batch = NULL;
+
+    for (int i = 0; i < assetFileCount; i++) {
+        cityRenderer.models[cityAssetFiles[i].type] = batchModels[i];
+        if (batchModels[i].meshCount == 0) {
+            printf("Failed to load: %s\n", cityAssetFiles[i].path);
+            cityRenderer.models[cityAssetFiles[i].type] = LoadModelFromMesh(GenMeshCube(1.0f, 1.0f, 1.0f));
         }
-
-    // --- Buildings ---
-    LOAD_ASSET(ASSET_AC_A, "resources/Buildings/detail-ac-a.obj");
-    LOAD_ASSET(ASSET_AC_B, "resources/Buildings/detail-ac-b.obj");
-    LOAD_ASSET(ASSET_DOOR_BROWN, "resources/Buildings/door-brown.obj");
-    LOAD_ASSET(ASSET_DOOR_BROWN_GLASS, "resources/Buildings/door-brown-glass.obj");
-    LOAD_ASSET(ASSET_DOOR_BROWN_WIN, "resources/Buildings/door-brown-window.obj");
-    LOAD_ASSET(ASSET_DOOR_WHITE, "resources/Buildings/door-white.obj"); 
-    LOAD_ASSET(ASSET_DOOR_WHITE_GLASS, "resources/Buildings/door-white-glass.obj");
-    LOAD_ASSET(ASSET_DOOR_WHITE_WIN, "resources/Buildings/door-white-window.obj");
-    LOAD_ASSET(ASSET_FRAME_DOOR1, "resources/Buildings/door1.obj");
-    LOAD_ASSET(ASSET_FRAME_SIMPLE, "resources/Buildings/simple_door.obj");
-    LOAD_ASSET(ASSET_FRAME_TENT, "resources/Buildings/doorframe_glass_tent.obj");
-    LOAD_ASSET(ASSET_FRAME_WIN, "resources/Buildings/window_door.obj");
-    LOAD_ASSET(ASSET_FRAME_WIN_WHITE, "resources/Buildings/window_door_white.obj");
-    LOAD_ASSET(ASSET_WIN_SIMPLE, "resources/Buildings/Windows_simple.obj");
-    LOAD_ASSET(ASSET_WIN_SIMPLE_W, "resources/Buildings/Windows_simple_white.obj");
-    LOAD_ASSET(ASSET_WIN_DET, "resources/Buildings/Windows_detailed.obj");
-    LOAD_ASSET(ASSET_WIN_DET_W, "resources/Buildings/Windows_detailed_white.obj");
-    LOAD_ASSET(ASSET_WIN_TWIN_TENT, "resources/Buildings/Twin_window_tents.obj");
-    LOAD_ASSET(ASSET_WIN_TWIN_TENT_W, "resources/Buildings/Twin_window_tents_white.obj");
-    LOAD_ASSET(ASSET_WIN_TALL, "resources/Buildings/windows_tall.obj");
-    LOAD_ASSET(ASSET_WIN_TALL_TOP, "resources/Buildings/windows_tall_top.obj");
-
-    // --- Props & Vegetation ---
-    LOAD_ASSET(ASSET_PROP_TREE_LARGE, "resources/trees/tree-large.obj");
-    LOAD_ASSET(ASSET_PROP_TREE_SMALL, "resources/trees/tree-small.obj");
-    LOAD_ASSET(ASSET_PROP_BENCH, "resources/random/bench.obj");
-    LOAD_ASSET(ASSET_PROP_FLOWERS, "resources/random/flowers.obj");
-    LOAD_ASSET(ASSET_PROP_GRASS, "resources/random/grass.obj");
-    LOAD_ASSET(ASSET_PROP_TRASH, "resources/random/trash.obj");
-    
-    LOAD_ASSET(ASSET_PROP_BOX, "resources/Props/box.obj");
-    LOAD_ASSET(ASSET_PROP_CONE, "resources/Props/cone.obj");
-    LOAD_ASSET(ASSET_PROP_CONE_FLAT, "resources/Props/cone-flat.obj");
-    LOAD_ASSET(ASSET_PROP_BARRIER, "resources/Props/construction-barrier.obj");
-    LOAD_ASSET(ASSET_PROP_CONST_LIGHT, "resources/Props/construction-light.obj");
-    LOAD_ASSET(ASSET_PROP_LIGHT_CURVED, "resources/Props/light-curved.obj");
-
-    // --- Vehicles ---
-    LOAD_ASSET(ASSET_CAR_DELIVERY, "resources/Playermodels/delivery.obj");
-    LOAD_ASSET(ASSET_CAR_HATCHBACK, "resources/Playermodels/hatchback-sports.obj");
-    LOAD_ASSET(ASSET_CAR_SEDAN, "resources/Playermodels/sedan.obj");
-    LOAD_ASSET(ASSET_CAR_SUV, "resources/Playermodels/suv.obj");
-    LOAD_ASSET(ASSET_CAR_VAN, "resources/Playermodels/van.obj");
-    LOAD_ASSET(ASSET_CAR_POLICE, "resources/Playermodels/police.obj");
+    }
 
     // --- Fix UVs for Procedural/Color-Tinted Objects ---
     float atlasW = 512.0f; 
@@ -2211,16 +2532,16 @@ void LoadCityAssets() {
     // Generate a shared leg model
     Mesh legMesh = GenMeshCube(0.1f, 1.0f, 0.1f); 
     
-    cityRenderer.locMechanicModel = LoadModel("resources/locations/pitsGarageClosed.obj");
-    cityRenderer.locFuelModel = LoadModel("resources/locations/pitsGarageCorner.obj");
-    cityRenderer.locDealershipModel = LoadModel("resources/locations/pitsOffice.obj");
+    cityRenderer.locMechanicModel = batchModels[assetFileCount + EXTRA_MECHANIC];
+    cityRenderer.locFuelModel = batchModels[assetFileCount + EXTRA_FUEL];
+    cityRenderer.locDealershipModel = batchModels[assetFileCount + EXTRA_DEALERSHIP];
 
     // Fallback if missing
     if(cityRenderer.locMechanicModel.meshCount == 0) cityRenderer.locMechanicModel = LoadModelFromMesh(GenMeshCube(4,3,4));
     if(cityRenderer.locFuelModel.meshCount == 0) cityRenderer.locFuelModel = LoadModelFromMesh(GenMeshCube(4,3,4));
     if(cityRenderer.locDealershipModel.meshCount == 0) cityRenderer.locDealershipModel = LoadModelFromMesh(GenMeshCube(4,3,4));
 
-    Model barRed = LoadModel("resources/locations/barrierWhite.obj");
+    Model barRed = batchModels[assetFileCount + EXTRA_BARRIER];
     if (barRed.meshCount > 0) cityRenderer.models[ASSET_PROP_BARRIER] = barRed;
 
     // Allocate memory for colors
@@ -2278,6 +2599,17 @@ void LoadCityAssets() {
     cityRenderer.loaded = true;
 }
 
+/*
+ * Description: Loads all 3D assets, textures, and models required for city rendering (main thread).
+ * Parameters: None.
+ * Returns: None.
+ */
+void LoadCityAssets() {
+    if (cityRenderer.loaded) return;
+    CityAssetData data = DecodeCityAssets();
+    UploadCityAssets(&data);
+}
+
 
 // --- HELPER: Event Visualizer ---
 
@@ -2543,7 +2875,8 @@ void BakeRoadDetails(GameMap *map) {
                     } 
                     // Random Clutter
                     else {
-                        int roll = GetRandomValue(0, 100);
+                        BakeRng rng = MakeBakeRng(map->seed, BAKE_STREAM_ROAD_PROPS, HashFloatBits(propPos.x), HashFloatBits(propPos.z));
+                        int roll = BakeRandomRange(&rng, 0, 100);
                         float baseRot = (side == 1) ? -angle : -angle + 180.0f;
 
                         if (roll < 3) { 
@@ -2562,15 +2895,15 @@ void BakeRoadDetails(GameMap *map) {
                         }
                         else if (roll < 20) {
                             Vector3 tScale = { 4.5f, 4.5f, 4.5f };
-                            BakeObjectToSector(ASSET_PROP_TREE_SMALL, propPos, GetRandomValue(0,360), tScale, treeTint);
+                            BakeObjectToSector(ASSET_PROP_TREE_SMALL, propPos, BakeRandomRange(&rng, 0, 360), tScale, treeTint);
                         }
                         else if (roll < 35) {
-                            if (GetRandomValue(0,1) == 0) {
+                            if (BakeRandomRange(&rng, 0, 1) == 0) {
                                 Vector3 gScale = { 1.5f, 1.0f, 1.5f };
-                                BakeObjectToSector(ASSET_PROP_GRASS, propPos, GetRandomValue(0,360), gScale, treeTint);
+                                BakeObjectToSector(ASSET_PROP_GRASS, propPos, BakeRandomRange(&rng, 0, 360), gScale, treeTint);
                             } else {
                                 Vector3 fScale = { 1.2f, 1.0f, 1.2f };
-                                BakeObjectToSector(ASSET_PROP_FLOWERS, propPos, GetRandomValue(0,360), fScale, WHITE);
+                                BakeObjectToSector(ASSET_PROP_FLOWERS, propPos, BakeRandomRange(&rng, 0, 360), fScale, WHITE);
                             }
                         }
                     }
@@ -2759,6 +3092,29 @@ static void DrawCenteredLabel(Camera camera, Vector3 position, const char *text,
 
 // --- RENDER ---
 
+#define MAX_NEARBY_LOCATIONS 4096
+
+/*
+ * Description: Collects the indices of all locations bucketed into a block of sectors.
+ * Parameters:
+ * - minX, maxX, minY, maxY: Inclusive sector range (already clamped to the grid).
+ * - outIndices: Buffer receiving location indices.
+ * - maxCount: Capacity of outIndices.
+ * Returns: Number of indices written.
+ */
+static int GatherSectorLocations(int minX, int maxX, int minY, int maxY, int *outIndices, int maxCount) {
+    int count = 0;
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            SectorManifest *man = &cityRenderer.manifests[y][x];
+            for (int k = 0; k < man->locationCount && count < maxCount; k++) {
+                outIndices[count++] = man->locationIndices[k];
+            }
+        }
+    }
+    return count;
+}
+
 /*
  * Description: Main 3D rendering pass for the game world. Handles sectors, props, events, and labels.
  * Parameters:
@@ -2845,41 +3201,26 @@ void DrawGameMap(GameMap *map, Camera camera) {
                  }
 
                  DrawModel(sec->model, (Vector3){0,0,0}, 1.0f, WHITE);
+
+                 int sectorTris = 0;
+                 for (int m = 0; m < sec->model.meshCount; m++) sectorTris += sec->model.meshes[m].triangleCount;
+                 PerfCountDraw(sec->model.meshCount, sectorTris);
              }
         }
     }
     
     // 4. Draw Locations (Props)
-    for (int i = 0; i < map->locationCount; i++) {
+    // [OPTIMIZATION] Only locations bucketed into the visible sectors; transforms precomputed at load
+    static int nearbyLocations[MAX_NEARBY_LOCATIONS];
+    int nearbyCount = GatherSectorLocations(minX, maxX, minY, maxY, nearbyLocations, MAX_NEARBY_LOCATIONS);
+
+    for (int n = 0; n < nearbyCount; n++) {
+        int i = nearbyLocations[n];
         if (Vector2Distance(pPos2D, map->locations[i].position) > RENDER_DIST_BASE) continue;
         
-        Vector3 drawPos = { map->locations[i].position.x, 0.0f, map->locations[i].position.y };
-        float rotAngle = 0.0f; 
-        
-        int nodeIdx = GetClosestNode(map, map->locations[i].position);
-        
-        if (nodeIdx != -1 && map->graph && map->graph[nodeIdx].count > 0) {
-            int edgeIdx = map->graph[nodeIdx].connections[0].edgeIndex;
-            Edge e = map->edges[edgeIdx];
-            Vector2 p1 = map->nodes[e.startNode].position;
-            Vector2 p2 = map->nodes[e.endNode].position;
-            
-            Vector2 roadDir = Vector2Normalize(Vector2Subtract(p2, p1));
-            Vector2 roadNormal = { -roadDir.y, roadDir.x }; 
-            
-            Vector2 toPoint = Vector2Subtract(map->locations[i].position, p1);
-            if (Vector2DotProduct(toPoint, roadNormal) < 0) roadNormal = Vector2Negate(roadNormal);
-            
-            float t = Vector2DotProduct(toPoint, roadDir);
-            Vector2 centerOnRoad = Vector2Add(p1, Vector2Scale(roadDir, t));
-            
-            float offset = (e.width * MAP_SCALE) + 5.0f; 
-            
-            Vector2 finalPos = Vector2Add(centerOnRoad, Vector2Scale(roadNormal, offset));
-            drawPos.x = finalPos.x;
-            drawPos.z = finalPos.y;
-            rotAngle = atan2f(-roadNormal.x, -roadNormal.y) * RAD2DEG;
-        }
+        LocationPlacement *lp = &cityRenderer.locationPlacements[i];
+        Vector3 drawPos = lp->drawPos;
+        float rotAngle = lp->rotAngle;
 
         float rad = rotAngle * DEG2RAD;
         float s = sinf(rad);
@@ -2973,35 +3314,12 @@ void DrawGameMap(GameMap *map, Camera camera) {
     }
     
     // 7. Draw Interaction Labels (Locations)
-    for (int i = 0; i < map->locationCount; i++) {
+    for (int n = 0; n < nearbyCount; n++) {
+        int i = nearbyLocations[n];
         if (map->locations[i].type == LOC_FUEL || map->locations[i].type == LOC_MECHANIC || map->locations[i].type == LOC_DEALERSHIP) {
             if (Vector2Distance(pPos2D, map->locations[i].position) > 50.0f) continue;
 
-            // Recalculate snapped pos
-            Vector3 targetPos = { map->locations[i].position.x, 0.9f, map->locations[i].position.y }; 
-            
-            int nodeIdx = GetClosestNode(map, map->locations[i].position);
-            if (nodeIdx != -1 && map->graph && map->graph[nodeIdx].count > 0) {
-                int edgeIdx = map->graph[nodeIdx].connections[0].edgeIndex;
-                Edge e = map->edges[edgeIdx];
-                Vector2 p1 = map->nodes[e.startNode].position;
-                Vector2 p2 = map->nodes[e.endNode].position;
-                
-                Vector2 roadDir = Vector2Normalize(Vector2Subtract(p2, p1));
-                Vector2 roadNormal = { -roadDir.y, roadDir.x }; 
-                
-                Vector2 toPoint = Vector2Subtract(map->locations[i].position, p1);
-                if (Vector2DotProduct(toPoint, roadNormal) < 0) roadNormal = Vector2Negate(roadNormal);
-                
-                float t = Vector2DotProduct(toPoint, roadDir);
-                Vector2 centerOnRoad = Vector2Add(p1, Vector2Scale(roadDir, t));
-                
-                float offset = (e.width * MAP_SCALE) + 4.0f; 
-                
-                Vector2 finalPos = Vector2Add(centerOnRoad, Vector2Scale(roadNormal, offset));
-                targetPos.x = finalPos.x;
-                targetPos.z = finalPos.y;
-            }
+            Vector3 targetPos = cityRenderer.locationPlacements[i].labelPos;
 
             if (Vector3DistanceSqr(targetPos, camera.position) < 144.0f) { 
                 const char* txt = 0;
@@ -3026,12 +3344,13 @@ void DrawGameMap(GameMap *map, Camera camera) {
  * Parameters:
  * - map: Pointer to GameMap.
  * - playerPos: Player position.
+ * - dt: Simulation delta time.
  * Returns: None.
  */
-void UpdateMapEffects(GameMap *map, Vector3 playerPos) {
+void UpdateMapEffects(GameMap *map, Vector3 playerPos, float dt) {
     for(int i = 0; i < MAX_EVENTS; i++) {
         if(map->events[i].active) {
-            map->events[i].timer -= GetFrameTime();
+            map->events[i].timer -= dt;
             if(map->events[i].timer <= 0) map->events[i].active = false;
         }
     }
@@ -3268,41 +3587,200 @@ bool CheckMapCollision(GameMap *map, float x, float z, float radius, bool isCame
 }
 
 /*
- * Description: Frees all allocated memory for the map, including nodes, edges, buildings, and the renderer.
+ * Description: Keeps the earliest contact of a sweep.
  * Parameters:
- * - map: Pointer to the GameMap to unload.
+ * - best: Current earliest hit.
+ * - t: Time of impact of the new contact.
+ * - normal: Contact normal of the new contact.
  * Returns: None.
  */
-void UnloadGameMap(GameMap *map) {
-    // 1. Free Map Data Arrays
-    if (map->nodes) free(map->nodes);
-    if (map->edges) free(map->edges);
-    
-    if (map->buildingCount > 0) {
-        for (int i = 0; i < map->buildingCount; i++) free(map->buildings[i].footprint);
+static void RecordSweepHit(MapSweepHit *best, float t, Vector2 normal) {
+    if (t < 0.0f) t = 0.0f;
+    if (!best->hit || t < best->time) {
+        best->hit = true;
+        best->time = t;
+        best->normal = normal;
     }
-    if (map->buildings) free(map->buildings);
+}
 
-    if (map->areaCount > 0) {
-        for (int i = 0; i < map->areaCount; i++) free(map->areas[i].points);
+/*
+ * Description: Sweeps a point against a circle (a segment endpoint or an event, already inflated by the mover radius).
+ * Parameters:
+ * - best: Earliest hit so far, updated on contact.
+ * - p: Start of the sweep.
+ * - d: Full movement vector.
+ * - c: Circle center.
+ * - r: Circle radius.
+ * Returns: None.
+ */
+static void SweepPointCircle(MapSweepHit *best, Vector2 p, Vector2 d, Vector2 c, float r) {
+    Vector2 m = Vector2Subtract(p, c);
+    float b = Vector2DotProduct(m, d);
+    float cc = Vector2DotProduct(m, m) - r * r;
+
+    // Already touching: block only the part of the move that goes deeper
+    if (cc <= 0.0f) {
+        if (b < 0.0f) RecordSweepHit(best, 0.0f, Vector2Normalize(m));
+        return;
     }
-    if (map->areas) free(map->areas);
-    
-    if (map->locations) free(map->locations);
-    
-    // 2. Free Graph
-    if (map->graph) {
-        for(int i = 0; i < map->nodeCount; i++) {
-            if(map->graph[i].connections) free(map->graph[i].connections);
-        }
-        free(map->graph);
+    if (b >= 0.0f) return; // Moving away
+
+    float a = Vector2DotProduct(d, d);
+    float disc = b * b - a * cc;
+    if (disc < 0.0f) return;
+
+    float t = (-b - sqrtf(disc)) / a;
+    if (t > 1.0f || (best->hit && t >= best->time)) return;
+    RecordSweepHit(best, t, Vector2Normalize(Vector2Add(m, Vector2Scale(d, t))));
+}
+
+/*
+ * Description: Sweeps a point against a segment inflated to a capsule: one slab test for the side, two circle tests for the ends.
+ * Parameters:
+ * - best: Earliest hit so far, updated on contact.
+ * - p: Start of the sweep.
+ * - d: Full movement vector.
+ * - a, b: Segment endpoints.
+ * - r: Capsule radius.
+ * Returns: None.
+ */
+static void SweepPointCapsule(MapSweepHit *best, Vector2 p, Vector2 d, Vector2 a, Vector2 b, float r) {
+    Vector2 ab = Vector2Subtract(b, a);
+    float lenSq = Vector2DotProduct(ab, ab);
+    if (lenSq < 0.0001f) {
+        SweepPointCircle(best, p, d, a, r);
+        return;
     }
 
-    // 3. Unload Renderer
-    if (cityRenderer.loaded) {
-        cityRenderer.activeSectorCount = 0;
-        
+    // Side normal, flipped to face the start point
+    float len = sqrtf(lenSq);
+    Vector2 n = { -ab.y / len, ab.x / len };
+    float dist = Vector2DotProduct(Vector2Subtract(p, a), n);
+    if (dist < 0.0f) { n = Vector2Negate(n); dist = -dist; }
+
+    float approach = Vector2DotProduct(d, n);
+    if (dist > r) {
+        if (approach >= 0.0f) return; // Moving away from this side, so the ends cannot be hit first
+        float t = (r - dist) / approach;
+        if (t > 1.0f) return;
+
+        Vector2 contact = Vector2Add(p, Vector2Scale(d, t));
+        float along = Vector2DotProduct(Vector2Subtract(contact, a), ab) / lenSq;
+        if (along >= 0.0f && along <= 1.0f) {
+            RecordSweepHit(best, t, n);
+            return;
+        }
+    } else {
+        // Start is inside the slab: touching the side if it projects onto the segment
+        float along = Vector2DotProduct(Vector2Subtract(p, a), ab) / lenSq;
+        if (along >= 0.0f && along <= 1.0f) {
+            if (approach < 0.0f) RecordSweepHit(best, 0.0f, n);
+            return;
+        }
+    }
+
+    SweepPointCircle(best, p, d, a, r);
+    SweepPointCircle(best, p, d, b, r);
+}
+
+/*
+ * Description: Swept-circle query against building walls (with the same wall buffer as CheckMapCollision)
+ *              and active events. One pass over the grid cells the move touches. With a radius of 0.3
+ *              the wall buffer is zero, so it doubles as an exact segment raycast (camera boom).
+ * Parameters:
+ * - map: Pointer to the GameMap.
+ * - start: Circle center at the start of the move.
+ * - move: Movement vector for this step.
+ * - radius: Collision radius of the entity.
+ * - isCamera: If true, ignores dynamic events (cameras clip through events).
+ * Returns: The earliest contact (time of impact and normal), or hit = false if the path is clear.
+ */
+MapSweepHit SweepMapCollision(GameMap *map, Vector2 start, Vector2 move, float radius, bool isCamera) {
+    MapSweepHit best = { false, 1.0f, { 0.0f, 0.0f } };
+    float wallDist = fmaxf(radius - 0.3f, 0.0f);
+
+    // Cells covering the swept bounds, plus the same one-cell margin CheckMapCollision uses
+    Vector2 end = Vector2Add(start, move);
+    int gx0 = (int)((fminf(start.x, end.x) + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) - 1;
+    int gx1 = (int)((fmaxf(start.x, end.x) + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) + 1;
+    int gy0 = (int)((fminf(start.y, end.y) + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) - 1;
+    int gy1 = (int)((fmaxf(start.y, end.y) + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) + 1;
+    if (gx0 < 0) gx0 = 0;
+    if (gy0 < 0) gy0 = 0;
+    if (gx1 >= SECTOR_GRID_COLS) gx1 = SECTOR_GRID_COLS - 1;
+    if (gy1 >= SECTOR_GRID_ROWS) gy1 = SECTOR_GRID_ROWS - 1;
+
+    // Swept bounds grown by the wall distance, to reject most walls before the capsule test
+    float minX = fminf(start.x, end.x) - wallDist, maxX = fmaxf(start.x, end.x) + wallDist;
+    float minY = fminf(start.y, end.y) - wallDist, maxY = fmaxf(start.y, end.y) + wallDist;
+
+    for (int cy = gy0; cy <= gy1; cy++) {
+        for (int cx = gx0; cx <= gx1; cx++) {
+            CollisionCell *cell = &colGrid[cy][cx];
+
+            for (int k = 0; k < cell->count; k++) {
+                Building *b = &map->buildings[cell->indices[k]];
+                for (int i = 0; i < b->pointCount; i++) {
+                    Vector2 v1 = b->footprint[i];
+                    Vector2 v2 = b->footprint[(i + 1) % b->pointCount];
+                    if (fmaxf(v1.x, v2.x) < minX || fminf(v1.x, v2.x) > maxX ||
+                        fmaxf(v1.y, v2.y) < minY || fminf(v1.y, v2.y) > maxY) continue;
+
+                    SweepPointCapsule(&best, start, move, v1, v2, wallDist);
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < MAX_EVENTS && !isCamera; i++) {
+        if (!map->events[i].active) continue;
+        SweepPointCircle(&best, start, move, map->events[i].position, (map->events[i].radius * 0.5f) + radius);
+    }
+
+    return best;
+}
+
+/*
+ * Description: Frees all allocated memory for the map, including nodes, edges, buildings, and the renderer.
+ * Parameters:
+ * - map: Pointer to the GameMap to unload.
+ * Returns: None.
+ */
+void UnloadGameMap(GameMap *map) {
+    // 1. Free Map Data Arrays
+    if (map->nodes) free(map->nodes);
+    if (map->edges) free(map->edges);
+    
+    if (map->buildingCount > 0) {
+        for (int i = 0; i < map->buildingCount; i++) free(map->buildings[i].footprint);
+    }
+    if (map->buildings) free(map->buildings);
+
+    if (map->areaCount > 0) {
+        for (int i = 0; i < map->areaCount; i++) free(map->areas[i].points);
+    }
+    if (map->areas) free(map->areas);
+    
+    if (map->locations) free(map->locations);
+    if (cityRenderer.locationPlacements) { free(cityRenderer.locationPlacements); cityRenderer.locationPlacements = NULL; }
+    for (int t = 0; t < LOC_COUNT; t++) {
+        if (locationTypeLists[t].indices) free(locationTypeLists[t].indices);
+        locationTypeLists[t] = (NodeCell){0};
+    }
+    
+    // 2. Free Graph
+    if (map->graph) {
+        for(int i = 0; i < map->nodeCount; i++) {
+            if(map->graph[i].connections) free(map->graph[i].connections);
+        }
+        free(map->graph);
+    }
+
+    // 3. Unload Renderer
+    if (cityRenderer.loaded) {
         // A. Unload SECTORS
+        // [FIX] UnloadSectorChunk maintains activeSectorCount itself; zeroing it first
+        // drove it negative and the next load wrote before activeSectors[].
         for (int y = 0; y < SECTOR_GRID_ROWS; y++) {
             for (int x = 0; x < SECTOR_GRID_COLS; x++) {
                 UnloadSectorChunk(x, y); 
@@ -3312,16 +3790,11 @@ void UnloadGameMap(GameMap *map) {
                     free(cityRenderer.builders[y][x]);
                     cityRenderer.builders[y][x] = NULL;
                 }
-                
-                SectorManifest *man = &cityRenderer.manifests[y][x];
-                if (man->buildingIndices) { free(man->buildingIndices); man->buildingIndices = NULL; }
-                if (man->edgeIndices) { free(man->edgeIndices); man->edgeIndices = NULL; }
-                if (man->areaIndices) { free(man->areaIndices); man->areaIndices = NULL; }
-                man->buildingCount = 0; man->buildingCap = 0;
-                man->edgeCount = 0; man->edgeCap = 0;
-                man->areaCount = 0; man->areaCap = 0;
             }
         }
+        ClearSectorManifests();
+        cityRenderer.activeSectorCount = 0;
+        cityRenderer.isSectorLoading = false;
         
         // B. Unload ASSETS
         // Zero out aliased models to prevent double-free
@@ -3350,6 +3823,9 @@ void UnloadGameMap(GameMap *map) {
             cityRenderer.nodeDegrees = NULL;
         }
 
+        // E. Unload 2D Map Tiles
+        UnloadMap2DTiles();
+
         cityRenderer.loaded = false;
         cityRenderer.mapBaked = false;
     }
@@ -3358,11 +3834,12 @@ void UnloadGameMap(GameMap *map) {
     if (colGridLoaded) {
         for(int y = 0; y < SECTOR_GRID_ROWS; y++) {
             for(int x = 0; x < SECTOR_GRID_COLS; x++) {
-                if (colGrid[y][x].indices) free(colGrid[y][x].indices);
+                // [FIX] Reset the cell too, BuildNodeGrid frees any non-NULL list on the next load
                 if (nodeGrid[y][x].indices) free(nodeGrid[y][x].indices); 
+                nodeGrid[y][x] = (NodeCell){0};
             }
         }
-        colGridLoaded = false;
+        ClearCollisionGrid();
     }
     
     // Free the static builder
@@ -3456,7 +3933,7 @@ int GetClosestNode(GameMap *map, Vector2 position) {
  * - maxPathLen: Maximum number of points in outPath.
  * Returns: The number of points in the calculated path.
  */
-int FindPath(GameMap *map, Vector2 startPos, Vector2 endPos, Vector2 *outPath, int maxPathLen) {
+static int FindPathAStar(GameMap *map, Vector2 startPos, Vector2 endPos, Vector2 *outPath, int maxPathLen) {
     if (!map->graph) BuildMapGraph(map);
     
     int startNode = GetClosestNode(map, startPos);
@@ -3537,6 +4014,146 @@ int FindPath(GameMap *map, Vector2 startPos, Vector2 endPos, Vector2 *outPath, i
     return pathLen;
 }
 
+/*
+ * Description: Public pathfinding entry point (profiled wrapper around FindPathAStar).
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - startPos: Starting world position.
+ * - endPos: Target world position.
+ * - outPath: Buffer to store the resulting path points.
+ * - maxPathLen: Maximum number of points in outPath.
+ * Returns: The number of points in the calculated path.
+ */
+int FindPath(GameMap *map, Vector2 startPos, Vector2 endPos, Vector2 *outPath, int maxPathLen) {
+    PROFILE_BEGIN("FindPath");
+    int pathLen = FindPathAStar(map, startPos, endPos, outPath, maxPathLen);
+    PROFILE_END();
+    return pathLen;
+}
+
+/*
+ * Description: Collects navigation nodes lying in the ring [minRadius, maxRadius] around a point.
+ * Only the node grid cells overlapping the ring are visited, so the cost depends on the ring
+ * size, not on the size of the map. When more nodes qualify than fit in outNodes, the buffer
+ * is filled by reservoir sampling so the kept subset stays spread around the whole ring
+ * instead of favouring the first cells in scan order.
+ * Parameters:
+ * - map: Pointer to the GameMap.
+ * - center: Ring center (world XZ).
+ * - minRadius: Inner radius.
+ * - maxRadius: Outer radius.
+ * - outNodes: Buffer receiving node indices.
+ * - maxNodes: Capacity of outNodes.
+ * Returns: Number of nodes written.
+ */
+int GetNodesInRing(GameMap *map, Vector2 center, float minRadius, float maxRadius, int *outNodes, int maxNodes) {
+    if (maxNodes <= 0) return 0;
+    int count = 0;
+    int seen = 0;
+    float minSq = minRadius * minRadius;
+    float maxSq = maxRadius * maxRadius;
+
+    int minX = (int)((center.x - maxRadius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    int maxX = (int)((center.x + maxRadius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    int minY = (int)((center.y - maxRadius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    int maxY = (int)((center.y + maxRadius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            if (x < 0 || x >= SECTOR_GRID_COLS || y < 0 || y >= SECTOR_GRID_ROWS) continue;
+            NodeCell *cell = &nodeGrid[y][x];
+            if (cell->count == 0) continue;
+
+            // Skip cells that sit completely inside the inner circle
+            float cellX0 = x * GRID_CELL_SIZE - SECTOR_WORLD_OFFSET;
+            float cellY0 = y * GRID_CELL_SIZE - SECTOR_WORLD_OFFSET;
+            float farX = fmaxf(fabsf(center.x - cellX0), fabsf(center.x - (cellX0 + GRID_CELL_SIZE)));
+            float farY = fmaxf(fabsf(center.y - cellY0), fabsf(center.y - (cellY0 + GRID_CELL_SIZE)));
+            if (farX*farX + farY*farY < minSq) continue;
+
+            for (int k = 0; k < cell->count; k++) {
+                int nodeIdx = cell->indices[k];
+                if (map->graph && map->graph[nodeIdx].count == 0) continue;
+                float d = Vector2DistanceSqr(center, map->nodes[nodeIdx].position);
+                if (d < minSq || d > maxSq) continue;
+
+                seen++;
+                if (count < maxNodes) {
+                    outNodes[count++] = nodeIdx;
+                } else {
+                    int slot = GetRandomValue(0, seen - 1);
+                    if (slot < maxNodes) outNodes[slot] = nodeIdx;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+/*
+ * Description: Collects locations of a given type within a radius, using the sector manifests.
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - center: 2D world position to search around.
+ * - radius: Search radius (strict, measured to MapLocation.position).
+ * - type: LocationType to match, or -1 for any type.
+ * - outIndices: Buffer receiving indices into map->locations.
+ * - maxResults: Capacity of outIndices.
+ * Returns: Number of indices written.
+ */
+int GetLocationsInRadius(GameMap *map, Vector2 center, float radius, int type, int *outIndices, int maxResults) {
+    int count = 0;
+    float radiusSq = radius * radius;
+
+    int minX = (int)((center.x - radius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    int maxX = (int)((center.x + radius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    int minY = (int)((center.y - radius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+    int maxY = (int)((center.y + radius + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            if (x < 0 || x >= SECTOR_GRID_COLS || y < 0 || y >= SECTOR_GRID_ROWS) continue;
+            SectorManifest *man = &cityRenderer.manifests[y][x];
+
+            for (int k = 0; k < man->locationCount; k++) {
+                int locIdx = man->locationIndices[k];
+                if (locIdx >= map->locationCount) continue;
+                if (type >= 0 && (int)map->locations[locIdx].type != type) continue;
+                if (Vector2DistanceSqr(center, map->locations[locIdx].position) >= radiusSq) continue;
+                if (count >= maxResults) return count;
+                outIndices[count++] = locIdx;
+            }
+        }
+    }
+    return count;
+}
+
+/*
+ * Description: Finds the closest location of a given type. Only walks that type's list.
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - position: 2D world position.
+ * - type: LocationType to match.
+ * Returns: Index into map->locations, or -1 if the map has none of that type.
+ */
+int GetNearestLocationOfType(GameMap *map, Vector2 position, int type) {
+    if (type < 0 || type >= LOC_COUNT) return -1;
+
+    NodeCell *list = &locationTypeLists[type];
+    int bestIdx = -1;
+    float minDstSq = FLT_MAX;
+    for (int k = 0; k < list->count; k++) {
+        int locIdx = list->indices[k];
+        if (locIdx >= map->locationCount) continue;
+        float d = Vector2DistanceSqr(position, map->locations[locIdx].position);
+        if (d < minDstSq) {
+            minDstSq = d;
+            bestIdx = locIdx;
+        }
+    }
+    return bestIdx;
+}
+
 /*
  * Description: Populates the node spatial grid to optimize GetClosestNode lookups.
  * Parameters:
@@ -3569,32 +4186,36 @@ void BuildNodeGrid(GameMap *map) {
 }
 
 /*
- * Description: Parses the map data file (nodes, edges, buildings) and initializes the game world.
+ * Description: Allocates the map arrays and parses the map data file (nodes, edges, buildings, areas, locations).
+ * Builds no grids, graph or render data; LoadGameMap does that afterwards.
  * Parameters:
  * - fileName: Path to the .map file.
- * Returns: The fully populated GameMap struct.
+ * - map: Zeroed GameMap to fill.
+ * Returns: False if the file could not be read.
  */
-GameMap LoadGameMap(const char *fileName) {
-    GameMap map = {0};
-    
+bool ParseGameMap(const char *fileName, GameMap *map) {
     // --- Allocation ---
-    map.nodes = (Node *)calloc(MAX_NODES, sizeof(Node));
-    map.edges = (Edge *)calloc(MAX_EDGES, sizeof(Edge));
-    map.buildings = (Building *)calloc(MAX_BUILDINGS, sizeof(Building));
-    map.locations = (MapLocation *)calloc(MAX_LOCATIONS, sizeof(MapLocation));
-    map.areas = (MapArea *)calloc(MAX_AREAS, sizeof(MapArea));
-    map.isBatchLoaded = false;
+    map->nodes = (Node *)calloc(MAX_NODES, sizeof(Node));
+    map->edges = (Edge *)calloc(MAX_EDGES, sizeof(Edge));
+    map->buildings = (Building *)calloc(MAX_BUILDINGS, sizeof(Building));
+    map->locations = (MapLocation *)calloc(MAX_LOCATIONS, sizeof(MapLocation));
+    map->areas = (MapArea *)calloc(MAX_AREAS, sizeof(MapArea));
+    map->isBatchLoaded = false;
     ClearMapBoundaries();
-    ClearEvents(&map);
-    LoadCityAssets(); 
+    ClearEvents(map);
 
     // --- File Parsing ---
     char *text = LoadFileText(fileName);
     if (!text) {
         printf("CRITICAL ERROR: Could not load map file %s\n", fileName);
-        return map;
+        return false;
     }
     
+    // Content hash (FNV-1a) seeds bake-time generation: same file, same city
+    unsigned int seed = 2166136261u;
+    for (const char *c = text; *c; c++) seed = (seed ^ (unsigned char)*c) * 16777619u;
+    map->seed = seed;
+
     char *line = strtok(text, "\n");
     int mode = 0; 
     
@@ -3604,46 +4225,46 @@ GameMap LoadGameMap(const char *fileName) {
         else if (strncmp(line, "BUILDINGS:", 10) == 0) { mode = 3; }
         else if (strncmp(line, "AREAS:", 6) == 0) { mode = 4; }
         else if (strncmp(line, "L ", 2) == 0) { 
-             if (map.locationCount < MAX_LOCATIONS) {
+             if (map->locationCount < MAX_LOCATIONS) {
                  int type; float x, y; char name[64];
                  if (sscanf(line, "L %d %f %f %63s", &type, &x, &y, name) == 4) {
-                     map.locations[map.locationCount].position = (Vector2){ x * MAP_SCALE, y * MAP_SCALE };
+                     map->locations[map->locationCount].position = (Vector2){ x * MAP_SCALE, y * MAP_SCALE };
                      if (type == 9) {
-                        map.locations[map.locationCount].type = LOC_DEALERSHIP;
+                        map->locations[map->locationCount].type = LOC_DEALERSHIP;
                     } else {
-                        map.locations[map.locationCount].type = (LocationType)type;
+                        map->locations[map->locationCount].type = (LocationType)type;
                     }
-                     map.locations[map.locationCount].iconID = type;
+                     map->locations[map->locationCount].iconID = type;
                      for(int k=0; name[k]; k++) if(name[k] == '_') name[k] = ' ';
-                     strncpy(map.locations[map.locationCount].name, name, 64);
-                     map.locationCount++;
+                     strncpy(map->locations[map->locationCount].name, name, 64);
+                     map->locationCount++;
                  }
              }
         }
         else {
-            if (mode == 1 && map.nodeCount < MAX_NODES) {
+            if (mode == 1 && map->nodeCount < MAX_NODES) {
                 int id; float x, y; int flags;
                 if (sscanf(line, "%d: %f %f %d", &id, &x, &y, &flags) >= 3) {
-                    map.nodes[map.nodeCount].id = id;
-                    map.nodes[map.nodeCount].position = (Vector2){x * MAP_SCALE, y * MAP_SCALE};
-                    map.nodes[map.nodeCount].flags = flags;
-                    map.nodeCount++;
+                    map->nodes[map->nodeCount].id = id;
+                    map->nodes[map->nodeCount].position = (Vector2){x * MAP_SCALE, y * MAP_SCALE};
+                    map->nodes[map->nodeCount].flags = flags;
+                    map->nodeCount++;
                 }
-            } else if (mode == 2 && map.edgeCount < MAX_EDGES) {
+            } else if (mode == 2 && map->edgeCount < MAX_EDGES) {
                 int start, end, oneway, speed, lanes; float width;
                 if (sscanf(line, "%d %d %f %d %d %d", &start, &end, &width, &oneway, &speed, &lanes) >= 3) {
-                    map.edges[map.edgeCount].startNode = start;
-                    map.edges[map.edgeCount].endNode = end;
-                    map.edges[map.edgeCount].width = width * MAP_SCALE;
-                    map.edges[map.edgeCount].oneway = oneway;
-                    map.edges[map.edgeCount].maxSpeed = speed;
-                    map.edgeCount++;
+                    map->edges[map->edgeCount].startNode = start;
+                    map->edges[map->edgeCount].endNode = end;
+                    map->edges[map->edgeCount].width = width * MAP_SCALE;
+                    map->edges[map->edgeCount].oneway = oneway;
+                    map->edges[map->edgeCount].maxSpeed = speed;
+                    map->edgeCount++;
                 }
-            } else if (mode == 3 && map.buildingCount < MAX_BUILDINGS) {
+            } else if (mode == 3 && map->buildingCount < MAX_BUILDINGS) {
                 float h; int r, g, b;
                 char *ptr = line;
                 int read = 0;
-                Building *build = &map.buildings[map.buildingCount];
+                Building *build = &map->buildings[map->buildingCount];
                 if (sscanf(ptr, "%f %d %d %d%n", &h, &r, &g, &b, &read) == 4) {
                     build->height = h * MAP_SCALE;
                     build->color = (Color){r, g, b, 255};
@@ -3657,13 +4278,13 @@ GameMap LoadGameMap(const char *fileName) {
                     build->footprint = (Vector2 *)malloc(sizeof(Vector2) * pCount);
                     memcpy(build->footprint, tempPoints, sizeof(Vector2) * pCount);
                     build->pointCount = pCount;
-                    if (pCount >= 3) map.buildingCount++;
+                    if (pCount >= 3) map->buildingCount++;
                 }
-            } else if (mode == 4 && map.areaCount < MAX_AREAS) {
+            } else if (mode == 4 && map->areaCount < MAX_AREAS) {
                 int type, r, g, b;
                 char *ptr = line;
                 int read = 0;
-                MapArea *area = &map.areas[map.areaCount];
+                MapArea *area = &map->areas[map->areaCount];
                 if (sscanf(ptr, "%d %d %d %d%n", &type, &r, &g, &b, &read) == 4) {
                     area->type = type;
                     area->color = (Color){r, g, b, 255};
@@ -3677,62 +4298,342 @@ GameMap LoadGameMap(const char *fileName) {
                     area->points = (Vector2 *)malloc(sizeof(Vector2) * pCount);
                     memcpy(area->points, tempPoints, sizeof(Vector2) * pCount);
                     area->pointCount = pCount;
-                    map.areaCount++;
+                    map->areaCount++;
                 }
             }
         }
         line = strtok(NULL, "\n");
     }
     UnloadFileText(text);
+    return true;
+}
+
+// --- BACKGROUND MAP LOADING ---
+
+typedef struct {
+    BackgroundJob *job;
+    GameMap map;
+    char fileName[256];
+    bool parsed;
+    bool needAssets;            // City assets not loaded yet: the loader decodes them, UpdateMapLoad uploads them
+    CityAssetData assets;
+    int sectorTotal;
+
+    // Shared between the loader thread and the main thread, guarded by lock
+    SharedLock *lock;
+    MapLoadStage stage;
+    int sectorsBaked;
+    bool assetsDecoded;         // assets is filled in and waiting for its upload
+    bool assetsUploaded;        // Main thread is done with assets; the loader may bake
+} MapLoadState;
+
+static MapLoadState mapLoad = {0};
+
+static void SetMapLoadStage(MapLoadStage stage) {
+    LockShared(mapLoad.lock);
+    mapLoad.stage = stage;
+    UnlockShared(mapLoad.lock);
+}
+
+/*
+ * Description: Loader thread: decodes the city assets (handing them to the main thread for upload), parses
+ *              the map and runs every CPU stage of the load, including the starting-zone sector bakes.
+ *              Leaves the GPU uploads to UpdateMapLoad and FinishMapLoad.
+ * Parameters:
+ * - context: Unused, state lives in mapLoad.
+ * Returns: None.
+ */
+static void MapLoadTask(void *context) {
+    (void)context;
+    PROFILE_THREAD_NAME("Map Loader");
+    GameMap *map = &mapLoad.map;
+
+    if (mapLoad.needAssets) {
+        SetMapLoadStage(MAP_LOAD_ASSETS);
+        PROFILE_BEGIN("DecodeCityAssets");
+        mapLoad.assets = DecodeCityAssets();
+        PROFILE_END();
+
+        LockShared(mapLoad.lock);
+        mapLoad.assetsDecoded = true;
+        UnlockShared(mapLoad.lock);
+    }
+
+    SetMapLoadStage(MAP_LOAD_PARSING);
+    if (!ParseGameMap(mapLoad.fileName, map)) {
+        SetMapLoadStage(MAP_LOAD_READY);
+        return;
+    }
+    mapLoad.parsed = true;
 
     printf("Map Data Loaded. Building Manifests...\n");
     
     // Sort all objects into their grid cells
-    BuildSectorManifests(&map);
+    SetMapLoadStage(MAP_LOAD_MANIFESTS);
+    PROFILE_BEGIN("BuildSectorManifests");
+    BuildSectorManifests(map);
+    PROFILE_END();
     
     // Build physics/traffic data
-    BuildCollisionGrid(&map);
-    BuildNodeGrid(&map);
-    BuildMapGraph(&map);
+    SetMapLoadStage(MAP_LOAD_GRAPH);
+    PROFILE_BEGIN("Build Grids & Graph");
+    BuildCollisionGrid(map);
+    BuildNodeGrid(map);
+    BuildMapGraph(map);
+    BuildLocationPlacements(map);
+    PROFILE_END();
+
+    // Baking reads the uploaded models (UV fix-ups included), so wait for the main thread
+    if (mapLoad.needAssets) {
+        PROFILE_BEGIN("Wait For Asset Upload");
+        for (;;) {
+            LockShared(mapLoad.lock);
+            bool uploaded = mapLoad.assetsUploaded;
+            UnlockShared(mapLoad.lock);
+            if (uploaded) break;
+            SleepMilliseconds(1);
+        }
+        PROFILE_END();
+    }
     
     // --- PRE-LOAD STARTING ZONE ---
-    // Force the system to process all stages instantly for the starting area.
+    // Run the CPU stages for the starting area now; each sector keeps its own builder until upload.
+    SetMapLoadStage(MAP_LOAD_BAKING);
     int startX = (int)((0.0f + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
     int startY = (int)((0.0f + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE);
     
+    deferSectorUploads = true;
     for (int y = startY - 1; y <= startY + 1; y++) {
         for (int x = startX - 1; x <= startX + 1; x++) {
             if (x >= 0 && x < SECTOR_GRID_COLS && y >= 0 && y < SECTOR_GRID_ROWS) {
+                if (cityRenderer.builders[y][x] == NULL) {
+                    cityRenderer.builders[y][x] = (SectorBuilder*)calloc(1, sizeof(SectorBuilder));
+                }
+                if (cityRenderer.builders[y][x] == NULL) continue;
+
                 // Manually trigger the load state
-                cityRenderer.loadingSectorX = x;
-                cityRenderer.loadingSectorY = y;
-                cityRenderer.isSectorLoading = true;
-                cityRenderer.sectors[y][x].loadStage = 0;
+                BeginSectorLoad(x, y);
 
-                // Force loop until this sector returns false (Done)
-                while(ProcessSectorLoadStep(&map));
+                // Force loop until this sector returns false (Baked)
+                while(ProcessSectorLoadStep(map));
             }
+            LockShared(mapLoad.lock);
+            mapLoad.sectorsBaked++;
+            UnlockShared(mapLoad.lock);
+        }
+    }
+    deferSectorUploads = false;
+
+    SetMapLoadStage(MAP_LOAD_READY);
+}
+
+/*
+ * Description: Starts loading a map on a loader thread: city asset decode, parsing, grids, graph and the
+ *              starting-zone bake. Call UpdateMapLoad every frame while it runs, then FinishMapLoad.
+ * Parameters:
+ * - fileName: Path to the .map file.
+ * Returns: None.
+ */
+void StartMapLoad(const char *fileName) {
+    static unsigned int nextLoadId = 0;
+    if (mapLoad.job) return; // One load at a time
+
+    if (mapHeadless) cityRenderer.loaded = true; // Streaming still runs, just without models
+
+    mapLoad.map = (GameMap){0};
+    mapLoad.map.loadId = ++nextLoadId;
+    snprintf(mapLoad.fileName, sizeof(mapLoad.fileName), "%s", fileName);
+    mapLoad.parsed = false;
+    mapLoad.needAssets = !cityRenderer.loaded;
+    mapLoad.assets = (CityAssetData){0};
+    mapLoad.stage = MAP_LOAD_IDLE;
+    mapLoad.sectorsBaked = 0;
+    mapLoad.sectorTotal = 9;
+    mapLoad.assetsDecoded = false;
+    mapLoad.assetsUploaded = false;
+
+    mapLoad.lock = CreateSharedLock();
+    if (!mapLoad.lock) {
+        printf("ERROR: Out of memory, cannot load %s\n", fileName);
+        return;
+    }
+
+    mapLoad.job = StartBackgroundThread(MapLoadTask, NULL);
+    if (!mapLoad.job) {
+        // No loader thread: load the assets here so the inline run never waits on the main thread
+        if (mapLoad.needAssets) {
+            PROFILE_BEGIN("LoadCityAssets");
+            LoadCityAssets();
+            PROFILE_END();
+            mapLoad.needAssets = false;
         }
+        mapLoad.job = StartBackgroundJob(MapLoadTask, NULL);
     }
+}
+
+/*
+ * Description: Main-thread side of a background load: uploads the city assets once the loader thread
+ *              has decoded them. Call every frame while a load runs (FinishMapLoad calls it too).
+ * Parameters: None.
+ * Returns: None.
+ */
+void UpdateMapLoad(void) {
+    if (!mapLoad.job || !mapLoad.needAssets) return;
+
+    LockShared(mapLoad.lock);
+    bool pending = mapLoad.assetsDecoded && !mapLoad.assetsUploaded;
+    UnlockShared(mapLoad.lock);
+    if (!pending) return;
+
+    PROFILE_BEGIN("UploadCityAssets");
+    UploadCityAssets(&mapLoad.assets);
+    PROFILE_END();
+
+    LockShared(mapLoad.lock);
+    mapLoad.assetsUploaded = true;
+    UnlockShared(mapLoad.lock);
+}
+
+/*
+ * Description: Returns which stage the background map load is in.
+ * Parameters: None.
+ * Returns: MapLoadStage value (MAP_LOAD_IDLE when no load is running).
+ */
+MapLoadStage GetMapLoadStage(void) {
+    if (!mapLoad.job) return MAP_LOAD_IDLE;
+
+    LockShared(mapLoad.lock);
+    MapLoadStage stage = mapLoad.stage;
+    UnlockShared(mapLoad.lock);
+    return stage;
+}
+
+/*
+ * Description: Estimates how far the background map load is, for the progress bar.
+ * Parameters: None.
+ * Returns: Progress in [0, 1] (1 once the CPU work is done).
+ */
+float GetMapLoadProgress(void) {
+    if (!mapLoad.job) return 0.0f;
+
+    LockShared(mapLoad.lock);
+    MapLoadStage stage = mapLoad.stage;
+    float baked = (float)mapLoad.sectorsBaked / (float)mapLoad.sectorTotal;
+    UnlockShared(mapLoad.lock);
+
+    switch (stage) {
+        case MAP_LOAD_ASSETS:    return 0.02f;
+        case MAP_LOAD_PARSING:   return 0.30f;
+        case MAP_LOAD_MANIFESTS: return 0.50f;
+        case MAP_LOAD_GRAPH:     return 0.58f;
+        case MAP_LOAD_BAKING:    return 0.70f + 0.30f * baked;
+        case MAP_LOAD_READY:     return 1.0f;
+        default:                 return 0.0f;
+    }
+}
+
+/*
+ * Description: Returns true once the loader thread has finished (FinishMapLoad will not block).
+ * Parameters: None.
+ * Returns: True if done or no load is running.
+ */
+bool IsMapLoadDone(void) {
+    return IsBackgroundJobDone(mapLoad.job);
+}
+
+/*
+ * Description: Waits for the loader thread (uploading the city assets if it still needs them), then uploads
+ *              the starting-zone sectors (main thread).
+ * Parameters: None.
+ * Returns: The loaded map (empty if no load was started).
+ */
+GameMap FinishMapLoad(void) {
+    GameMap map = {0};
+    if (!mapLoad.job) return map;
+
+    // Keep servicing the asset upload while waiting, the loader thread blocks on it
+    while (!IsBackgroundJobDone(mapLoad.job)) {
+        UpdateMapLoad();
+        SleepMilliseconds(1);
+    }
+    UpdateMapLoad(); // Parse failures finish without waiting for the upload
+    FinishBackgroundJob(mapLoad.job);
+    mapLoad.job = NULL;
+    DestroySharedLock(mapLoad.lock);
+    mapLoad.lock = NULL;
+    map = mapLoad.map;
+    mapLoad.map = (GameMap){0};
+    if (!mapLoad.parsed) return map;
+
+    PROFILE_BEGIN("Upload Starting Zone");
+    for (int y = 0; y < SECTOR_GRID_ROWS; y++) {
+        for (int x = 0; x < SECTOR_GRID_COLS; x++) {
+            SectorBuilder *sb = cityRenderer.builders[y][x];
+            if (!sb) continue;
+
+            if (cityRenderer.sectors[y][x].loadStage == 4) CompleteSectorUpload(x, y, sb);
+            FreeSectorBuilder(sb);
+            free(sb);
+            cityRenderer.builders[y][x] = NULL;
+        }
+    }
+    PROFILE_END();
 
     printf("Map Ready.\n");
     return map;
 }
 
+/*
+ * Description: Abandons an in-flight background load (window closed while loading) and frees its data.
+ * Parameters: None.
+ * Returns: None.
+ */
+void CancelMapLoad(void) {
+    if (!mapLoad.job) return;
+    GameMap map = FinishMapLoad();
+    UnloadGameMap(&map);
+}
+
+/*
+ * Description: Loads a map synchronously (tools, headless runs): StartMapLoad + FinishMapLoad.
+ * Parameters:
+ * - fileName: Path to the .map file.
+ * Returns: The loaded GameMap.
+ */
+GameMap LoadGameMap(const char *fileName) {
+    StartMapLoad(fileName);
+    return FinishMapLoad();
+}
+
 // --- 2D MAP RENDERER ---
 
+// Tiles are baked at power-of-two pixels-per-unit levels and composited through the
+// app's Camera2D, so heading-up rotation only rotates textured quads.
+#define MAP_TILE_PIXELS 256
+#define MAP_TILE_CACHE_SIZE 64
+#define MAP_TILE_MIN_LEVEL -1        // 0.5 px per world unit
+#define MAP_TILE_MAX_LEVEL 4         // 16 px per world unit
+#define MAP_TILE_BAKES_PER_FRAME 4
+
+typedef struct {
+    RenderTexture2D target;
+    int level;
+    int tx, ty;
+    unsigned int mapId;   // GameMap.loadId the tile was baked from, 0 = empty
+    unsigned int lastUsed;
+} MapTile;
+
+static MapTile mapTiles[MAP_TILE_CACHE_SIZE] = {0};
+static unsigned int mapTileFrame = 0;
+
 /*
- * Description: Renders the 2D map view (used for the phone app/minimap) using the optimized sector grid.
+ * Description: Computes the axis-aligned world rectangle covered by a (possibly rotated) 2D camera.
  * Parameters:
- * - map: Pointer to GameMap.
  * - cam: The 2D Camera.
  * - screenW, screenH: Dimensions of the render area.
- * Returns: None.
+ * Returns: World-space bounds.
  */
-void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH) {
-    if (!cityRenderer.loaded) return;
-
-    // 1. Calculate Visible World Bounds
+static Rectangle GetMap2DWorldBounds(Camera2D cam, float screenW, float screenH) {
     Vector2 corners[4];
     corners[0] = GetScreenToWorld2D((Vector2){0, 0}, cam);             // Top Left
     corners[1] = GetScreenToWorld2D((Vector2){screenW, 0}, cam);       // Top Right
@@ -3749,21 +4650,33 @@ void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH) {
         if (corners[i].y > maxWorldY) maxWorldY = corners[i].y;
     }
 
-    // 2. Convert to Grid Coordinates
+    return (Rectangle){ minWorldX, minWorldY, maxWorldX - minWorldX, maxWorldY - minWorldY };
+}
+
+/*
+ * Description: Vector pass for the 2D map. Draws areas, roads and buildings for every sector touching the bounds.
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - bounds: World-space rectangle to cover.
+ * - zoom: Pixels per world unit, used for line widths and detail thresholds.
+ * Returns: None.
+ */
+static void DrawMap2DSectors(GameMap *map, Rectangle bounds, float zoom) {
+    // 1. Convert to Grid Coordinates
     int buffer = 2;
-    int minX = (int)((minWorldX + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) - buffer;
-    int minY = (int)((minWorldY + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) - buffer;
-    int maxX = (int)((maxWorldX + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) + buffer;
-    int maxY = (int)((maxWorldY + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) + buffer;
+    int minX = (int)((bounds.x + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) - buffer;
+    int minY = (int)((bounds.y + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) - buffer;
+    int maxX = (int)((bounds.x + bounds.width + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) + buffer;
+    int maxY = (int)((bounds.y + bounds.height + SECTOR_WORLD_OFFSET) / GRID_CELL_SIZE) + buffer;
 
     if (minX < 0) minX = 0;
     if (minY < 0) minY = 0;
     if (maxX >= SECTOR_GRID_COLS) maxX = SECTOR_GRID_COLS - 1;
     if (maxY >= SECTOR_GRID_ROWS) maxY = SECTOR_GRID_ROWS - 1;
 
-    float scale = 1.0f / cam.zoom;
+    float scale = 1.0f / zoom;
 
-    // 3. Iterate Visible Sectors
+    // 2. Iterate Visible Sectors
     for (int y = minY; y <= maxY; y++) {
         for (int x = minX; x <= maxX; x++) {
             SectorManifest *man = &cityRenderer.manifests[y][x];
@@ -3782,7 +4695,7 @@ void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH) {
                     Color areaColor = Fade(area->color, 0.4f);
                     DrawTriangleFan(area->points, area->pointCount, areaColor);
                     
-                    if (cam.zoom > 1.0f) {
+                    if (zoom > 1.0f) {
                         DrawLineStrip(area->points, area->pointCount, areaColor);
                     }
                 }
@@ -3797,7 +4710,7 @@ void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH) {
                 
                 DrawLineEx(s, en, e.width, LIGHTGRAY);
                 
-                if (e.width > 5.0f && cam.zoom > 2.0f) {
+                if (e.width > 5.0f && zoom > 2.0f) {
                     DrawLineEx(s, en, 1.0f * scale, WHITE);
                 }
             }
@@ -3808,7 +4721,7 @@ void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH) {
                 
                 DrawTriangleFan(b->footprint, b->pointCount, Fade(b->color, 0.5f));
                 
-                if (cam.zoom > 1.5f) {
+                if (zoom > 1.5f) {
                     for(int j = 0; j < b->pointCount; j++) {
                         Vector2 p1 = b->footprint[j];
                         Vector2 p2 = b->footprint[(j+1)%b->pointCount];
@@ -3818,4 +4731,208 @@ void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH) {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+/*
+ * Description: Picks the tile level (log2 pixels per world unit) closest to the camera zoom.
+ * Parameters:
+ * - zoom: Camera zoom.
+ * Returns: The tile level.
+ */
+static int GetMapTileLevel(float zoom) {
+    int level = (int)roundf(log2f(zoom));
+    if (level < MAP_TILE_MIN_LEVEL) level = MAP_TILE_MIN_LEVEL;
+    if (level > MAP_TILE_MAX_LEVEL) level = MAP_TILE_MAX_LEVEL;
+    return level;
+}
+
+/*
+ * Description: Looks up a baked tile in the cache.
+ * Parameters:
+ * - map: Pointer to GameMap (tiles from other maps never match).
+ * - level, tx, ty: Tile key.
+ * Returns: The tile, or NULL if it isn't cached.
+ */
+static MapTile* FindMapTile(GameMap *map, int level, int tx, int ty) {
+    for (int i = 0; i < MAP_TILE_CACHE_SIZE; i++) {
+        MapTile *tile = &mapTiles[i];
+        if (tile->mapId == map->loadId && tile->level == level && tile->tx == tx && tile->ty == ty) return tile;
+    }
+    return NULL;
+}
+
+/*
+ * Description: Renders one tile through the vector pass into an LRU cache slot.
+ * Must be called outside any other BeginTextureMode block.
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - level, tx, ty: Tile key.
+ * Returns: The baked tile, or NULL if every slot is in use this frame.
+ */
+static MapTile* BakeMapTile(GameMap *map, int level, int tx, int ty) {
+    // Pick an empty/stale slot, otherwise the least recently used one not needed this frame
+    MapTile *slot = NULL;
+    for (int i = 0; i < MAP_TILE_CACHE_SIZE; i++) {
+        MapTile *tile = &mapTiles[i];
+        if (tile->mapId != map->loadId) { slot = tile; break; }
+        if (tile->lastUsed == mapTileFrame) continue;
+        if (!slot || tile->lastUsed < slot->lastUsed) slot = tile;
+    }
+    if (!slot) return NULL;
+
+    if (slot->target.id == 0) {
+        slot->target = LoadRenderTexture(MAP_TILE_PIXELS, MAP_TILE_PIXELS);
+        SetTextureFilter(slot->target.texture, TEXTURE_FILTER_BILINEAR);
+        SetTextureWrap(slot->target.texture, TEXTURE_WRAP_CLAMP);
+    }
+
+    float zoom = ldexpf(1.0f, level);
+    float tileWorld = MAP_TILE_PIXELS / zoom;
+    Rectangle bounds = { tx * tileWorld, ty * tileWorld, tileWorld, tileWorld };
+
+    Camera2D tileCam = { 0 };
+    tileCam.target = (Vector2){ bounds.x, bounds.y };
+    tileCam.zoom = zoom;
+
+    // Tiles are opaque (the app background is RAYWHITE) so translucent parks blend exactly as before
+    BeginTextureMode(slot->target);
+        ClearBackground(RAYWHITE);
+        BeginMode2D(tileCam);
+            DrawMap2DSectors(map, bounds, zoom);
+        EndMode2D();
+    EndTextureMode();
+
+    slot->level = level;
+    slot->tx = tx;
+    slot->ty = ty;
+    slot->mapId = map->loadId;
+    slot->lastUsed = mapTileFrame;
+    return slot;
+}
+
+/*
+ * Description: Makes sure the tiles visible through the camera are baked, a few per frame.
+ * Call during update, before the phone's render texture is bound.
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - cam: The 2D Camera.
+ * - screenW, screenH: Dimensions of the render area.
+ * Returns: None.
+ */
+void PrepareMap2DTiles(GameMap *map, Camera2D cam, float screenW, float screenH) {
+    if (!cityRenderer.loaded) return;
+    mapTileFrame++;
+
+    int level = GetMapTileLevel(cam.zoom);
+    float tileWorld = MAP_TILE_PIXELS / ldexpf(1.0f, level);
+    Rectangle view = GetMap2DWorldBounds(cam, screenW, screenH);
+
+    int tx0 = (int)floorf(view.x / tileWorld);
+    int ty0 = (int)floorf(view.y / tileWorld);
+    int tx1 = (int)floorf((view.x + view.width) / tileWorld);
+    int ty1 = (int)floorf((view.y + view.height) / tileWorld);
+
+    // Touch everything visible first so eviction never steals a tile we're about to draw
+    for (int ty = ty0; ty <= ty1; ty++) {
+        for (int tx = tx0; tx <= tx1; tx++) {
+            MapTile *tile = FindMapTile(map, level, tx, ty);
+            if (tile) tile->lastUsed = mapTileFrame;
+        }
+    }
+
+    int baked = 0;
+    for (int ty = ty0; ty <= ty1 && baked < MAP_TILE_BAKES_PER_FRAME; ty++) {
+        for (int tx = tx0; tx <= tx1 && baked < MAP_TILE_BAKES_PER_FRAME; tx++) {
+            if (FindMapTile(map, level, tx, ty)) continue;
+            if (!BakeMapTile(map, level, tx, ty)) return;
+            baked++;
+        }
+    }
+}
+
+/*
+ * Description: Releases all cached 2D map tiles.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UnloadMap2DTiles(void) {
+    for (int i = 0; i < MAP_TILE_CACHE_SIZE; i++) {
+        if (mapTiles[i].target.id != 0) UnloadRenderTexture(mapTiles[i].target);
+        mapTiles[i] = (MapTile){0};
+    }
+}
+
+/*
+ * Description: Reports streaming/VRAM figures for the performance overlay. The VRAM number is an
+ * estimate: resident sector meshes, the shared textures and the baked minimap tiles.
+ * Parameters:
+ * - residentSectors: Out, number of sectors currently loaded.
+ * - gpuBytes: Out, estimated GPU memory in bytes.
+ * Returns: None.
+ */
+void GetMapRenderStats(int *residentSectors, size_t *gpuBytes) {
+    size_t bytes = 0;
+
+    for (int i = 0; i < cityRenderer.activeSectorCount; i++) {
+        Sector *sec = &cityRenderer.sectors[cityRenderer.activeSectors[i].y][cityRenderer.activeSectors[i].x];
+        if (sec->isEmpty) continue;
+        // Baked sector meshes: position + normal + texcoord + color
+        for (int m = 0; m < sec->model.meshCount; m++) {
+            bytes += (size_t)sec->model.meshes[m].vertexCount * (3*4 + 3*4 + 2*4 + 4);
+        }
+    }
+
+    if (cityRenderer.whiteTex.id != 0) bytes += (size_t)cityRenderer.whiteTex.width * cityRenderer.whiteTex.height * 4;
+    if (cityRenderer.sharedAtlas.id != 0) bytes += (size_t)cityRenderer.sharedAtlas.width * cityRenderer.sharedAtlas.height * 4;
+
+    // Minimap tiles: color + depth attachment
+    for (int i = 0; i < MAP_TILE_CACHE_SIZE; i++) {
+        if (mapTiles[i].target.id != 0) bytes += (size_t)MAP_TILE_PIXELS * MAP_TILE_PIXELS * 8;
+    }
+
+    *residentSectors = cityRenderer.activeSectorCount;
+    *gpuBytes = bytes;
+}
+
+/*
+ * Description: Renders the 2D map view (used for the phone app/minimap). Composites cached tiles when
+ * every visible tile is baked, otherwise falls back to the vector pass for this frame.
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - cam: The 2D Camera.
+ * - screenW, screenH: Dimensions of the render area.
+ * Returns: None.
+ */
+void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH) {
+    if (!cityRenderer.loaded) return;
+
+    Rectangle view = GetMap2DWorldBounds(cam, screenW, screenH);
+
+    int level = GetMapTileLevel(cam.zoom);
+    float tileWorld = MAP_TILE_PIXELS / ldexpf(1.0f, level);
+    int tx0 = (int)floorf(view.x / tileWorld);
+    int ty0 = (int)floorf(view.y / tileWorld);
+    int tx1 = (int)floorf((view.x + view.width) / tileWorld);
+    int ty1 = (int)floorf((view.y + view.height) / tileWorld);
+
+    bool allCached = true;
+    for (int ty = ty0; ty <= ty1 && allCached; ty++) {
+        for (int tx = tx0; tx <= tx1 && allCached; tx++) {
+            if (!FindMapTile(map, level, tx, ty)) allCached = false;
+        }
+    }
+
+    if (!allCached) {
+        DrawMap2DSectors(map, view, cam.zoom);
+        return;
+    }
+
+    Rectangle source = { 0.0f, 0.0f, (float)MAP_TILE_PIXELS, -(float)MAP_TILE_PIXELS };
+    for (int ty = ty0; ty <= ty1; ty++) {
+        for (int tx = tx0; tx <= tx1; tx++) {
+            MapTile *tile = FindMapTile(map, level, tx, ty);
+            Rectangle dest = { tx * tileWorld, ty * tileWorld, tileWorld, tileWorld };
+            DrawTexturePro(tile->target.texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+        }
+    }
+}
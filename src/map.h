@@ -20,6 +20,7 @@
 #include "raylib.h"
 #include "player.h" 
 #include "dealership.h"
+#include <stddef.h>
 
 // --- CONSTANTS ---
 #define MAX_NODES 200000
@@ -130,6 +131,13 @@ typedef struct {
     char label[64];   // Text to display on the 3D prop
 } MapEvent;
 
+// Result of a swept-circle query against buildings and events
+typedef struct {
+    bool hit;
+    float time;       // Fraction of the move (0..1) at first contact
+    Vector2 normal;   // Contact normal, pointing away from the obstacle
+} MapSweepHit;
+
 // [FIXED] Added struct tag 'GameMap' so forward declarations work
 typedef struct GameMap {
     Node *nodes;
@@ -144,6 +152,8 @@ typedef struct GameMap {
     int areaCount;
     
     NodeGraph *graph; // Navigation Graph
+    unsigned int loadId; // Unique per LoadGameMap call; lets callers invalidate cached map queries
+    unsigned int seed;   // Hash of the .map file; seeds all bake-time generation (trees, building styles, AC units)
     
     // NEW: Active Events
     MapEvent events[MAX_EVENTS];
@@ -151,12 +161,35 @@ typedef struct GameMap {
     bool isBatchLoaded;
 } GameMap;
 
+// Background map load progress (see StartMapLoad)
+typedef enum {
+    MAP_LOAD_IDLE,
+    MAP_LOAD_ASSETS,        // Decoding city models and textures (first load only)
+    MAP_LOAD_PARSING,       // Reading the .map file
+    MAP_LOAD_MANIFESTS,     // Sorting objects into sectors
+    MAP_LOAD_GRAPH,         // Collision/node grids, road graph, location placements
+    MAP_LOAD_BAKING,        // Starting-zone sector geometry
+    MAP_LOAD_READY          // CPU work done, FinishMapLoad will not block
+} MapLoadStage;
+
 // --- PROTOTYPES ---
 GameMap LoadGameMap(const char *fileName);
 void UnloadGameMap(GameMap *map);
+
+// Background loading: StartMapLoad runs everything CPU-side on a loader thread, city asset
+// decode included. Call UpdateMapLoad and poll the progress from the UI loop (it uploads the
+// decoded assets on the main thread); FinishMapLoad uploads the starting zone and returns the
+// map. LoadGameMap = Start + Finish.
+void StartMapLoad(const char *fileName);
+void UpdateMapLoad(void);
+MapLoadStage GetMapLoadStage(void);
+float GetMapLoadProgress(void);
+bool IsMapLoadDone(void);
+GameMap FinishMapLoad(void);
+void CancelMapLoad(void);
 // UPDATED: Now takes Camera for text labels
 void DrawGameMap(GameMap *map, Camera camera); 
-void UpdateMapEffects(GameMap *map, Vector3 playerPos);
+void UpdateMapEffects(GameMap *map, Vector3 playerPos, float dt);
 Vector3 GetSmartDeliveryPos(GameMap *map, Vector3 buildingCenter);
 void DrawZoneMarker(GameMap *map, Camera camera, Vector3 pos, Color color);
 
@@ -164,10 +197,14 @@ void DrawZoneMarker(GameMap *map, Camera camera, Vector3 pos, Color color);
 void BuildMapGraph(GameMap *map);
 int FindPath(GameMap *map, Vector2 startPos, Vector2 endPos, Vector2 *outPath, int maxPathLen);
 int GetClosestNode(GameMap *map, Vector2 position);
+int GetNodesInRing(GameMap *map, Vector2 center, float minRadius, float maxRadius, int *outNodes, int maxNodes);
 
 // Search & Collision
 int SearchLocations(GameMap *map, const char* query, MapLocation* results);
+int GetLocationsInRadius(GameMap *map, Vector2 center, float radius, int type, int *outIndices, int maxResults);
+int GetNearestLocationOfType(GameMap *map, Vector2 position, int type);
 bool CheckMapCollision(GameMap *map, float x, float z, float radius, bool isCamera);
+MapSweepHit SweepMapCollision(GameMap *map, Vector2 start, Vector2 move, float radius, bool isCamera);
 
 // NEW: Event System
 void TriggerRandomEvent(GameMap *map, Vector3 playerPos, Vector3 playerFwd);
@@ -186,7 +223,24 @@ void ResetMapCamera(Vector2 pos); // Required by main.c respawn logic
 void UpdateRuntimeParks(GameMap *map, Vector3 playerPos);
 void DrawRuntimeParks(Vector3 playerPos);
 void UpdateMapStreaming(GameMap *map, Vector3 playerPos);
+void SetMapHeadless(bool headless); // Benchmark harness: CPU-only map, call before LoadGameMap
+
+// Load pipeline stages (LoadGameMap runs them in order; exposed for tools/map_bench.c)
+bool ParseGameMap(const char *fileName, GameMap *map);
+void BuildSectorManifests(GameMap *map);
+void ClearSectorManifests(void);
+void BuildCollisionGrid(GameMap *map);
+void ClearCollisionGrid(void);
+void BuildLocationPlacements(GameMap *map); // After BuildMapGraph; adds locations to the manifests
+int TriangulatePolygon(Vector2 *points, int count, int *outIndices);
+bool GetSectorAt(Vector2 worldPos, int *outX, int *outY);
+void BeginSectorLoad(int x, int y);
+bool ProcessSectorLoadStep(GameMap *map);
+int GetSectorLoadStage(int x, int y);
+void UnloadSectorChunk(int x, int y);
 void DrawMap2DView(GameMap *map, Camera2D cam, float screenW, float screenH);
+void PrepareMap2DTiles(GameMap *map, Camera2D cam, float screenW, float screenH);
+void GetMapRenderStats(int *residentSectors, size_t *gpuBytes);
 // Add to map.h
 void LoadMapBoundaries(const char* fileName);
 bool CheckInvisibleBorder(Vector3 playerPos, float radius, Vector3 *pushOut);
@@ -517,6 +517,18 @@ void UpdateMapsApp(GameMap *map, Vector2 currentPlayerPos, float playerAngle, Ve
     }
 }
 
+/*
+ * Description: Bakes any minimap tiles the current camera needs. Call after all camera
+ * updates for the frame and before the phone's render texture is bound, since
+ * DrawMapsApp runs inside it and tiles bake into their own render textures.
+ * Parameters:
+ * - map: Pointer to the GameMap.
+ * Returns: None.
+ */
+void PrepareMapsApp(GameMap *map) {
+    PrepareMap2DTiles(map, mapsState.camera, 280.0f, 600.0f);
+}
+
 /*
  * Description: Renders the map application visuals, including the map view, icons, paths, and UI overlay.
  * Parameters:
@@ -27,10 +27,12 @@ typedef struct GameMap GameMap;
 void InitMapsApp();
 // Updated signature: Now accepts 'playerAngle'
 void UpdateMapsApp(GameMap *map, Vector2 currentPlayerPos, float playerAngle, Vector2 localMouse, bool isClicking);
+void PrepareMapsApp(GameMap *map);
 void DrawMapsApp(GameMap *map);
 void SetMapDestination(GameMap *map, Vector2 dest);
 void PreviewMapLocation(GameMap *map, Vector2 target);
 void ResetMapCamera(Vector2 playerPos);
+Vector2 SnapToRoad(GameMap *map, Vector2 clickPos, float threshold);
 
 bool IsMapsAppTyping();
 
@@ -0,0 +1,408 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#include "music_player.h"
+#include "raylib.h"
+#include "phone.h"
+#include "thread_pool.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MUSIC_TICK_MS 5             // Worker refill period (raylib buffers hold far longer than this)
+#define MUSIC_PATH_LEN 128
+#define TRACK_END_MARGIN 0.1f       // Seconds before the end that count as "finished"
+
+// A track opened off the worker thread so switching to it does not stall the refills
+typedef struct {
+    char path[MUSIC_PATH_LEN];
+    int index;
+    unsigned int playlistId;
+    Music music;
+} MusicPreload;
+
+typedef struct {
+    // --- Shared with the main thread (guarded by lock) ---
+    SharedLock *lock;
+    char paths[MAX_SONGS][MUSIC_PATH_LEN];
+    int trackCount;
+    unsigned int playlistId;    // Bumped by SetMusicPlaylist
+    unsigned int commandSerial; // Bumped by every command
+    unsigned int appliedSerial; // Last commandSerial the worker finished applying
+    int requestTrack;           // -1 = none
+    bool requestPause;
+    bool requestResume;
+    bool requestStop;
+    bool quit;
+    MusicPlayerStatus status;
+
+    // --- Worker only ---
+    BackgroundJob *thread;
+    unsigned int loadedPlaylistId;
+    Music current;
+    int currentIndex;
+    float currentLength;
+    bool paused;
+    Music next;                 // Preloaded, ready to play
+    int nextIndex;
+    BackgroundJob *preloadJob;
+    MusicPreload preload;
+    bool failed[MAX_SONGS];     // Tracks of the loaded playlist that could not be opened (not retried)
+} MusicPlayer;
+
+static MusicPlayer music = { 0 };
+
+// --- WORKER SIDE ---
+
+static void PreloadTask(void *context) {
+    MusicPreload *preload = (MusicPreload *)context;
+    preload->music = LoadMusicStream(preload->path);
+    preload->music.looping = false; // The playlist advances manually
+}
+
+static void UnloadTrack(Music *track) {
+    if (IsMusicValid(*track)) UnloadMusicStream(*track);
+    *track = (Music){ 0 };
+}
+
+static void CopyTrackPath(int index, char *out) {
+    LockShared(music.lock);
+    snprintf(out, MUSIC_PATH_LEN, "%s", music.paths[index]);
+    UnlockShared(music.lock);
+}
+
+/*
+ * Description: Waits for the preload job (if any) and keeps its stream as the next track,
+ * unless the playlist changed while it was opening.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void FinishPreload(void) {
+    if (!music.preloadJob) return;
+    FinishBackgroundJob(music.preloadJob);
+    music.preloadJob = NULL;
+
+    bool samePlaylist = (music.preload.playlistId == music.loadedPlaylistId);
+    if (samePlaylist && IsMusicValid(music.preload.music)) {
+        UnloadTrack(&music.next);
+        music.next = music.preload.music;
+        music.nextIndex = music.preload.index;
+    } else {
+        if (samePlaylist) {
+            printf("MUSIC: Could not open track %d, skipping it.\n", music.preload.index);
+            music.failed[music.preload.index] = true;
+        }
+        UnloadTrack(&music.preload.music);
+    }
+    music.preload.music = (Music){ 0 };
+}
+
+/*
+ * Description: Finds the next track after a given one that has not failed to open, wrapping around.
+ * Parameters:
+ * - from: Index to start after (-1 starts at the first track).
+ * - trackCount: Playlist size.
+ * Returns: Track index (may be from itself), or -1 if every track failed.
+ */
+static int NextPlayableTrack(int from, int trackCount) {
+    for (int step = 1; step <= trackCount; step++) {
+        int index = (from + step) % trackCount;
+        if (!music.failed[index]) return index;
+    }
+    return -1;
+}
+
+static void DropPreload(void) {
+    FinishPreload();
+    UnloadTrack(&music.next);
+    music.nextIndex = -1;
+}
+
+static void CloseCurrentTrack(void) {
+    if (music.currentIndex < 0) return;
+    StopMusicStream(music.current);
+    UnloadTrack(&music.current);
+    music.currentIndex = -1;
+    music.currentLength = 0.0f;
+    music.paused = false;
+}
+
+/*
+ * Description: Switches playback to a track, taking the preloaded stream when it matches.
+ * Parameters:
+ * - index: Playlist index.
+ * Returns: None.
+ */
+static void OpenTrack(int index) {
+    CloseCurrentTrack();
+
+    // Waits only if this very track is still being opened
+    if (music.preloadJob && music.preload.index == index) FinishPreload();
+
+    Music track;
+    if (music.nextIndex == index) {
+        track = music.next;
+        music.next = (Music){ 0 };
+        music.nextIndex = -1;
+    } else {
+        char path[MUSIC_PATH_LEN];
+        CopyTrackPath(index, path);
+        track = LoadMusicStream(path);
+        track.looping = false;
+    }
+
+    if (!IsMusicValid(track)) {
+        printf("MUSIC: Could not open track %d.\n", index);
+        music.failed[index] = true;
+        return;
+    }
+
+    music.current = track;
+    music.currentIndex = index;
+    music.currentLength = GetMusicTimeLength(track);
+    music.paused = false;
+    PlayMusicStream(track);
+}
+
+/*
+ * Description: Keeps the track after the current one (or the first, when idle) opening in the background.
+ * Parameters:
+ * - trackCount: Playlist size.
+ * Returns: None.
+ */
+static void UpdatePreload(int trackCount) {
+    if (music.preloadJob && IsBackgroundJobDone(music.preloadJob)) FinishPreload();
+    if (music.preloadJob || trackCount == 0) return;
+
+    int want = NextPlayableTrack(music.currentIndex, trackCount);
+    if (want < 0 || want == music.currentIndex || want == music.nextIndex) return;
+
+    UnloadTrack(&music.next);
+    music.nextIndex = -1;
+
+    CopyTrackPath(want, music.preload.path);
+    music.preload.index = want;
+    music.preload.playlistId = music.loadedPlaylistId;
+    music.preloadJob = StartBackgroundJob(PreloadTask, &music.preload);
+}
+
+/*
+ * Description: One worker tick: applies posted commands, refills the stream buffers, advances
+ * the playlist when a track ends, and publishes the status.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void MusicWorkerStep(void) {
+    LockShared(music.lock);
+    unsigned int playlistId = music.playlistId;
+    unsigned int serial = music.commandSerial;
+    int trackCount = music.trackCount;
+    int requestTrack = music.requestTrack;
+    bool pause = music.requestPause;
+    bool resume = music.requestResume;
+    bool stop = music.requestStop;
+    music.requestTrack = -1;
+    music.requestPause = music.requestResume = music.requestStop = false;
+    UnlockShared(music.lock);
+
+    // 1. COMMANDS
+    if (playlistId != music.loadedPlaylistId) {
+        CloseCurrentTrack();
+        music.loadedPlaylistId = playlistId;
+        DropPreload();
+        memset(music.failed, 0, sizeof(music.failed));
+    }
+    if (stop) CloseCurrentTrack();
+    if (requestTrack >= 0 && requestTrack < trackCount) OpenTrack(requestTrack);
+
+    if (pause && music.currentIndex >= 0 && !music.paused) {
+        PauseMusicStream(music.current);
+        music.paused = true;
+    }
+    if (resume) {
+        if (music.currentIndex < 0 && trackCount > 0) {
+            int first = NextPlayableTrack(-1, trackCount);
+            if (first >= 0) OpenTrack(first);
+        }
+        else if (music.paused) {
+            ResumeMusicStream(music.current);
+            music.paused = false;
+        }
+    }
+
+    // 2. REFILL & AUTO-NEXT
+    float played = 0.0f;
+    if (music.currentIndex >= 0 && !music.paused) {
+        UpdateMusicStream(music.current);
+        played = GetMusicTimePlayed(music.current);
+
+        bool finished = !IsMusicStreamPlaying(music.current) ||
+                        (music.currentLength > 0.0f && played >= music.currentLength - TRACK_END_MARGIN);
+        if (finished && trackCount > 0) {
+            // Tracks that fail to open get marked, so this moves past them and stops if none is left
+            int from = music.currentIndex;
+            int next;
+            while ((next = NextPlayableTrack(from, trackCount)) >= 0) {
+                OpenTrack(next);
+                if (music.currentIndex >= 0) break;
+                from = next;
+            }
+            played = 0.0f;
+        }
+    } else if (music.currentIndex >= 0) {
+        played = GetMusicTimePlayed(music.current);
+    }
+
+    // 3. PRELOAD
+    UpdatePreload(trackCount);
+
+    // 4. PUBLISH
+    LockShared(music.lock);
+    music.status.trackIndex = music.currentIndex;
+    music.status.playing = (music.currentIndex >= 0 && !music.paused);
+    music.status.timePlayed = played;
+    music.status.duration = music.currentLength;
+    music.appliedSerial = serial;
+    UnlockShared(music.lock);
+}
+
+static void MusicWorkerMain(void *context) {
+    (void)context;
+    for (;;) {
+        LockShared(music.lock);
+        bool quit = music.quit;
+        UnlockShared(music.lock);
+        if (quit) break;
+
+        MusicWorkerStep();
+        SleepMilliseconds(MUSIC_TICK_MS);
+    }
+}
+
+// --- MAIN THREAD SIDE ---
+
+/*
+ * Description: Creates the shared state and starts the audio worker thread.
+ * Parameters: None.
+ * Returns: None.
+ */
+void StartMusicPlayer(void) {
+    if (music.lock) return;
+
+    music = (MusicPlayer){ 0 };
+    music.lock = CreateSharedLock();
+    if (!music.lock) return;
+
+    music.requestTrack = -1;
+    music.currentIndex = -1;
+    music.nextIndex = -1;
+    music.status.trackIndex = -1;
+
+    music.thread = StartBackgroundThread(MusicWorkerMain, NULL);
+    if (!music.thread) printf("MUSIC: No audio thread, streaming from the main loop.\n");
+}
+
+/*
+ * Description: Joins the audio worker and releases every stream it holds.
+ * Parameters: None.
+ * Returns: None.
+ */
+void StopMusicPlayer(void) {
+    if (!music.lock) return;
+
+    if (music.thread) {
+        LockShared(music.lock);
+        music.quit = true;
+        UnlockShared(music.lock);
+        FinishBackgroundJob(music.thread);
+        music.thread = NULL;
+    }
+
+    // The worker is gone, so its state is ours now
+    CloseCurrentTrack();
+    DropPreload();
+    DestroySharedLock(music.lock);
+    music.lock = NULL;
+}
+
+void SetMusicPlaylist(const char **paths, int count) {
+    if (!music.lock) return;
+    if (count > MAX_SONGS) count = MAX_SONGS;
+
+    LockShared(music.lock);
+    for (int i = 0; i < count; i++) snprintf(music.paths[i], MUSIC_PATH_LEN, "%s", paths[i]);
+    music.trackCount = (count > 0) ? count : 0;
+    music.playlistId++;
+    music.requestTrack = -1;
+    music.commandSerial++;
+    UnlockShared(music.lock);
+}
+
+void PlayMusicTrack(int index) {
+    if (!music.lock) return;
+    LockShared(music.lock);
+    music.requestTrack = index;
+    music.requestPause = false;
+    music.commandSerial++;
+    UnlockShared(music.lock);
+}
+
+void PauseMusic(void) {
+    if (!music.lock) return;
+    LockShared(music.lock);
+    music.requestPause = true;
+    music.requestResume = false;
+    music.commandSerial++;
+    UnlockShared(music.lock);
+}
+
+void ResumeMusic(void) {
+    if (!music.lock) return;
+    LockShared(music.lock);
+    music.requestResume = true;
+    music.requestPause = false;
+    music.commandSerial++;
+    UnlockShared(music.lock);
+}
+
+void StopMusic(void) {
+    if (!music.lock) return;
+    LockShared(music.lock);
+    music.requestStop = true;
+    music.requestTrack = -1;
+    music.requestPause = music.requestResume = false;
+    music.commandSerial++;
+    UnlockShared(music.lock);
+}
+
+/*
+ * Description: Runs a worker tick on the main thread when the audio thread could not be started.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UpdateMusicPlayer(void) {
+    if (music.lock && !music.thread) MusicWorkerStep();
+}
+
+MusicPlayerStatus GetMusicPlayerStatus(void) {
+    MusicPlayerStatus status = { -1, false, 0.0f, 0.0f, true };
+    if (!music.lock) return status;
+
+    LockShared(music.lock);
+    status = music.status;
+    status.settled = (music.appliedSerial == music.commandSerial);
+    UnlockShared(music.lock);
+    return status;
+}
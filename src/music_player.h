@@ -0,0 +1,57 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef MUSIC_PLAYER_H
+#define MUSIC_PLAYER_H
+
+#include <stdbool.h>
+
+// Music playback runs on an audio worker thread that refills the stream buffers on its
+// own ~5 ms schedule (independent of the frame rate, loading hitches or game state) and
+// opens the next track in the background. All raylib Music calls happen on that thread;
+// the game only posts commands and reads back a status copy.
+
+typedef struct MusicPlayerStatus {
+    int trackIndex;     // Track loaded in the player, -1 if none
+    bool playing;       // False when paused, stopped or between tracks
+    float timePlayed;   // Seconds into the current track
+    float duration;     // Length of the current track (0 until it is opened)
+    bool settled;       // Every posted command has been applied (fields reflect the last request)
+} MusicPlayerStatus;
+
+// Starts the audio worker (after InitAudioDevice). Falls back to pumping from
+// UpdateMusicPlayer on the main thread if no thread can be created.
+void StartMusicPlayer(void);
+
+// Stops playback, joins the worker and unloads every stream (before CloseAudioDevice)
+void StopMusicPlayer(void);
+
+// Replaces the playlist (copies the paths) and stops the current track. count = 0 clears it
+// and unloads every stream. The worker starts opening the first track right away.
+void SetMusicPlaylist(const char **paths, int count);
+
+// Commands, applied by the worker on its next tick
+void PlayMusicTrack(int index);
+void PauseMusic(void);
+void ResumeMusic(void);
+void StopMusic(void);
+
+// Main-thread pump: only does work when the worker thread is not running
+void UpdateMusicPlayer(void);
+
+MusicPlayerStatus GetMusicPlayerStatus(void);
+
+#endif // MUSIC_PLAYER_H
@@ -0,0 +1,258 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#include "perf_overlay.h"
+#include "raylib.h"
+#include "map.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+// --- CONSTANTS ---
+#define PERF_HISTORY 240            // Samples kept for the rolling graphs (~4s at 60 FPS)
+#define PERF_STACK_DEPTH 8
+#define PERF_CSV_PATH "perf_log.csv"
+
+static const char *perfNames[PERF_SUBSYSTEM_COUNT] = {
+    "Streaming", "Traffic", "Player", "Phone", "Map Draw", "UI", "Present"
+};
+
+static const Color perfColors[PERF_SUBSYSTEM_COUNT] = {
+    { 0, 228, 48, 255 },    // Streaming
+    { 253, 249, 0, 255 },   // Traffic
+    { 0, 121, 241, 255 },   // Player
+    { 200, 122, 255, 255 }, // Phone
+    { 255, 161, 0, 255 },   // Map Draw
+    { 102, 191, 255, 255 }, // UI
+    { 130, 130, 130, 255 }  // Present
+};
+
+// --- STATE ---
+static bool overlayVisible = false;
+static FILE *csvFile = NULL;
+static unsigned int csvFrame = 0;
+
+static double frameStart = 0.0;
+static double zoneStart = 0.0;
+static PerfSubsystem zoneStack[PERF_STACK_DEPTH];
+static int zoneDepth = 0;
+
+static float currentMs[PERF_SUBSYSTEM_COUNT] = { 0 };
+static int currentDrawCalls = 0;
+static int currentTriangles = 0;
+
+// Rolling history (ring buffer, historyHead = next write slot)
+static float historyMs[PERF_SUBSYSTEM_COUNT][PERF_HISTORY] = { 0 };
+static float historyFrameMs[PERF_HISTORY] = { 0 };
+static int historyHead = 0;
+
+// Last completed frame
+static float lastFrameMs = 0.0f;
+static int lastDrawCalls = 0;
+static int lastTriangles = 0;
+static int lastResidentSectors = 0;
+static size_t lastGpuBytes = 0;
+
+/*
+ * Description: Marks the start of a frame and resets per-frame counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PerfBeginFrame(void) {
+    frameStart = GetTime();
+    zoneDepth = 0;
+    for (int i = 0; i < PERF_SUBSYSTEM_COUNT; i++) currentMs[i] = 0.0f;
+    currentDrawCalls = 0;
+    currentTriangles = 0;
+}
+
+/*
+ * Description: Starts timing a subsystem. Time spent in the enclosing zone is paused until this one ends.
+ * Parameters:
+ * - subsystem: The subsystem being entered.
+ * Returns: None.
+ */
+void PerfBegin(PerfSubsystem subsystem) {
+    double now = GetTime();
+    if (zoneDepth > 0) currentMs[zoneStack[zoneDepth - 1]] += (float)((now - zoneStart) * 1000.0);
+    if (zoneDepth < PERF_STACK_DEPTH) zoneStack[zoneDepth++] = subsystem;
+    zoneStart = now;
+}
+
+/*
+ * Description: Stops timing a subsystem and resumes the enclosing zone, if any.
+ * Parameters:
+ * - subsystem: The subsystem being left (must match the last PerfBegin).
+ * Returns: None.
+ */
+void PerfEnd(PerfSubsystem subsystem) {
+    if (zoneDepth == 0 || zoneStack[zoneDepth - 1] != subsystem) return;
+    double now = GetTime();
+    currentMs[subsystem] += (float)((now - zoneStart) * 1000.0);
+    zoneDepth--;
+    zoneStart = now;
+}
+
+/*
+ * Description: Adds mesh draws issued by a renderer to this frame's totals.
+ * Parameters:
+ * - drawCalls: Number of GPU draw calls.
+ * - triangles: Number of triangles submitted.
+ * Returns: None.
+ */
+void PerfCountDraw(int drawCalls, int triangles) {
+    currentDrawCalls += drawCalls;
+    currentTriangles += triangles;
+}
+
+/*
+ * Description: Closes the frame, pushes it into the rolling history and the CSV dump.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PerfEndFrame(void) {
+    lastFrameMs = (float)((GetTime() - frameStart) * 1000.0);
+    lastDrawCalls = currentDrawCalls;
+    lastTriangles = currentTriangles;
+
+    for (int i = 0; i < PERF_SUBSYSTEM_COUNT; i++) historyMs[i][historyHead] = currentMs[i];
+    historyFrameMs[historyHead] = lastFrameMs;
+    historyHead = (historyHead + 1) % PERF_HISTORY;
+
+    // Streaming stats walk the resident sectors, so only gather them when someone is looking
+    if (!overlayVisible && !csvFile) return;
+    GetMapRenderStats(&lastResidentSectors, &lastGpuBytes);
+
+    if (csvFile) {
+        fprintf(csvFile, "%u,%.3f", csvFrame++, lastFrameMs);
+        for (int i = 0; i < PERF_SUBSYSTEM_COUNT; i++) fprintf(csvFile, ",%.3f", currentMs[i]);
+        fprintf(csvFile, ",%d,%d,%d,%.2f\n", lastDrawCalls, lastTriangles, lastResidentSectors, lastGpuBytes / (1024.0 * 1024.0));
+    }
+}
+
+/*
+ * Description: Handles the overlay hotkeys.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UpdatePerfOverlay(void) {
+    if (IsKeyPressed(KEY_F5)) overlayVisible = !overlayVisible;
+
+    if (IsKeyPressed(KEY_F6)) {
+        if (csvFile) {
+            fclose(csvFile);
+            csvFile = NULL;
+            printf("PERF: CSV dump stopped (%u frames)\n", csvFrame);
+        } else {
+            csvFile = fopen(PERF_CSV_PATH, "w");
+            if (csvFile) {
+                csvFrame = 0;
+                fprintf(csvFile, "frame,frame_ms");
+                for (int i = 0; i < PERF_SUBSYSTEM_COUNT; i++) fprintf(csvFile, ",%s_ms", perfNames[i]);
+                fprintf(csvFile, ",draw_calls,triangles,resident_sectors,gpu_mb\n");
+                printf("PERF: CSV dump started -> %s\n", PERF_CSV_PATH);
+            } else {
+                printf("PERF: Could not open %s\n", PERF_CSV_PATH);
+            }
+        }
+    }
+}
+
+/*
+ * Description: Draws the overlay: per-subsystem timings with sparklines, frame graph and render stats.
+ * Parameters: None.
+ * Returns: None.
+ */
+void DrawPerfOverlay(void) {
+    if (!overlayVisible) return;
+
+    int panelW = 360;
+    int rowH = 22;
+    int graphH = 70;
+    int panelH = 60 + PERF_SUBSYSTEM_COUNT * rowH + graphH + 90;
+    int x = GetScreenWidth() - panelW - 10;
+    int y = 10;
+
+    DrawRectangle(x, y, panelW, panelH, Fade(BLACK, 0.75f));
+    DrawText("PERFORMANCE (F5)", x + 10, y + 8, 10, LIGHTGRAY);
+    DrawText(csvFile ? "CSV: REC (F6)" : "CSV: off (F6)", x + panelW - 95, y + 8, 10, csvFile ? RED : GRAY);
+    DrawText(TextFormat("Frame %.2f ms  (%d FPS)", lastFrameMs, GetFPS()), x + 10, y + 26, 20, WHITE);
+
+    // --- Subsystem rows: name, last value, sparkline ---
+    int last = (historyHead + PERF_HISTORY - 1) % PERF_HISTORY;
+    int sparkX = x + 170;
+    int sparkW = panelW - 180;
+    int rowY = y + 56;
+
+    for (int i = 0; i < PERF_SUBSYSTEM_COUNT; i++) {
+        DrawRectangle(x + 10, rowY + 5, 8, 8, perfColors[i]);
+        DrawText(TextFormat("%-10s %6.2f", perfNames[i], historyMs[i][last]), x + 24, rowY + 3, 10, WHITE);
+
+        float peak = 1.0f;
+        for (int s = 0; s < PERF_HISTORY; s++) if (historyMs[i][s] > peak) peak = historyMs[i][s];
+
+        for (int s = 1; s < PERF_HISTORY; s++) {
+            int a = (historyHead + s - 1) % PERF_HISTORY;
+            int b = (historyHead + s) % PERF_HISTORY;
+            float x0 = sparkX + (s - 1) * (float)sparkW / PERF_HISTORY;
+            float x1 = sparkX + s * (float)sparkW / PERF_HISTORY;
+            float y0 = rowY + rowH - 4 - (historyMs[i][a] / peak) * (rowH - 6);
+            float y1 = rowY + rowH - 4 - (historyMs[i][b] / peak) * (rowH - 6);
+            DrawLineV((Vector2){ x0, y0 }, (Vector2){ x1, y1 }, perfColors[i]);
+        }
+        rowY += rowH;
+    }
+
+    // --- Frame time graph with 60 / 30 FPS budget lines ---
+    int graphX = x + 10;
+    int graphW = panelW - 20;
+    int graphY = rowY + 6;
+    float graphMax = 50.0f;
+
+    DrawRectangleLines(graphX, graphY, graphW, graphH, DARKGRAY);
+    float line60 = graphY + graphH - (16.67f / graphMax) * graphH;
+    float line30 = graphY + graphH - (33.33f / graphMax) * graphH;
+    DrawLine(graphX, (int)line60, graphX + graphW, (int)line60, Fade(GREEN, 0.5f));
+    DrawLine(graphX, (int)line30, graphX + graphW, (int)line30, Fade(RED, 0.5f));
+
+    float barW = (float)graphW / PERF_HISTORY;
+    for (int s = 0; s < PERF_HISTORY; s++) {
+        int idx = (historyHead + s) % PERF_HISTORY;
+        float ms = historyFrameMs[idx];
+        if (ms > graphMax) ms = graphMax;
+        float h = (ms / graphMax) * graphH;
+        Color c = (historyFrameMs[idx] > 33.33f) ? RED : (historyFrameMs[idx] > 16.67f) ? ORANGE : LIME;
+        DrawRectangle(graphX + (int)(s * barW), graphY + graphH - (int)h, (int)barW + 1, (int)h, c);
+    }
+
+    // --- Render stats ---
+    int statY = graphY + graphH + 10;
+    DrawText(TextFormat("Mesh draws: %d   Triangles: %d", lastDrawCalls, lastTriangles), x + 10, statY, 10, WHITE);
+    DrawText(TextFormat("Resident sectors: %d", lastResidentSectors), x + 10, statY + 16, 10, WHITE);
+    DrawText(TextFormat("VRAM estimate: %.1f MB", lastGpuBytes / (1024.0 * 1024.0)), x + 10, statY + 32, 10, WHITE);
+    DrawText("GPU timer queries: n/a (Present = flush + swap + wait)", x + 10, statY + 48, 10, GRAY);
+}
+
+/*
+ * Description: Flushes and closes the CSV dump.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UnloadPerfOverlay(void) {
+    if (csvFile) {
+        fclose(csvFile);
+        csvFile = NULL;
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef PERF_OVERLAY_H
+#define PERF_OVERLAY_H
+
+#include <stddef.h>
+
+// Subsystems timed by the performance overlay (exclusive time, nesting allowed)
+typedef enum {
+    PERF_STREAMING = 0,
+    PERF_TRAFFIC,
+    PERF_PLAYER,
+    PERF_PHONE,
+    PERF_MAP_DRAW,
+    PERF_UI,
+    PERF_PRESENT,       // EndDrawing: batch flush, swap and frame-limit wait
+    PERF_SUBSYSTEM_COUNT
+} PerfSubsystem;
+
+// Frame bracketing (call once per frame, around everything else)
+void PerfBeginFrame(void);
+void PerfEndFrame(void);
+
+// Subsystem timing. An inner zone pauses the outer one, so times never double count.
+void PerfBegin(PerfSubsystem subsystem);
+void PerfEnd(PerfSubsystem subsystem);
+
+// Mesh draw statistics, reported by the renderers that issue them
+void PerfCountDraw(int drawCalls, int triangles);
+
+// F5 toggles the overlay, F6 toggles the CSV dump (perf_log.csv)
+void UpdatePerfOverlay(void);
+void DrawPerfOverlay(void);
+
+// Closes the CSV dump if it is running
+void UnloadPerfOverlay(void);
+
+#endif
@@ -26,6 +26,7 @@
 #include "maps_app.h" 
 #include "delivery_app.h"
 #include "car_monitor.h" 
+#include "music_player.h"
 
 // --- CONSTANTS ---
 #define BASE_SCREEN_H 720.0f
@@ -44,6 +45,21 @@ static char notifText[64] = "";
 static float notifTimer = 0.0f;
 static Color notifColor = WHITE;
 
+// --- RETAINED SCREEN STATE ---
+// The screen texture is only re-rendered when something it shows may have changed
+typedef struct {
+    bool valid;
+    bool redrawNext;        // A click was handled mid-draw; its result shows next frame
+    PhoneApp app;
+    Vector2 mouse;
+    bool wasNotifying;
+    unsigned int dataHash;
+    long clockMinute;
+    char clockText[8];
+} PhoneScreenCache;
+
+static PhoneScreenCache screenCache = { 0 };
+
 // --- Helper Functions ---
 
 /*
@@ -118,13 +134,9 @@ void InitPhone(PhoneState *phone, GameMap *map) {
     InitMapsApp(); 
     InitDeliveryApp(phone, map);
 
-    // Init Music
-    for(int i = 0; i < 3; i++) {
-        phone->music.library[i].stream = LoadMusicStream(phone->music.library[i].filePath);
-        phone->music.library[i].duration = GetMusicTimeLength(phone->music.library[i].stream);
-        phone->music.library[i].stream.looping = true; 
-    }
-    phone->music.currentSongIdx = 0;
+    // Init Music (names only; the audio worker opens the tracks in the background)
+    phone->music.isInitialized = false;
+    LoadMusicLibrary(phone);
     phone->music.isPlaying = false;
 
     phone->settings.masterVolume = 0.8f;
@@ -277,7 +289,8 @@ void ParseFilename(const char* filename, char* titleOut, char* artistOut) {
 }
 
 /*
- * Description: Scans the resources/Music directory and loads compatible audio files.
+ * Description: Scans the resources/Music directory and hands the compatible files to the audio worker.
+ * Tracks are only opened when they are about to play, so this never blocks on decoding.
  * Parameters:
  * - phone: Pointer to PhoneState.
  * Returns: None.
@@ -305,12 +318,9 @@ void LoadMusicLibrary(PhoneState *phone) {
             {
                 Song *s = &phone->music.library[phone->music.songCount];
                 
-                // Load Stream
-                s->stream = LoadMusicStream(files.paths[i]);
-                s->stream.looping = false; // We handle playlist looping manually
-                
-                // Get Metadata
-                s->duration = GetMusicTimeLength(s->stream);
+                // Metadata (duration is filled in once the worker opens the track)
+                snprintf(s->filePath, sizeof(s->filePath), "%s", files.paths[i]);
+                s->duration = 0.0f;
                 ParseFilename(GetFileName(files.paths[i]), s->title, s->artist);
                 
                 phone->music.songCount++;
@@ -319,6 +329,10 @@ void LoadMusicLibrary(PhoneState *phone) {
         UnloadDirectoryFiles(files);
     }
 
+    const char *paths[MAX_SONGS];
+    for (int i = 0; i < phone->music.songCount; i++) paths[i] = phone->music.library[i].filePath;
+    SetMusicPlaylist(paths, phone->music.songCount);
+
     if (phone->music.songCount > 0) {
         printf("MUSIC: Loaded %d songs.\n", phone->music.songCount);
     } else {
@@ -353,19 +367,6 @@ void DrawAppMusic(PhoneState *phone, Vector2 mouse, bool click) {
     // --- CASE B: MUSIC PLAYER ---
     Song *s = &phone->music.library[phone->music.currentSongIdx];
 
-    // Update Stream Buffer (MUST be called every frame while playing)
-    if (phone->music.isPlaying) {
-        UpdateMusicStream(s->stream);
-        
-        // Auto-Next song when finished
-        if (GetMusicTimePlayed(s->stream) >= s->duration - 0.1f) {
-            StopMusicStream(s->stream);
-            phone->music.currentSongIdx++;
-            if (phone->music.currentSongIdx >= phone->music.songCount) phone->music.currentSongIdx = 0;
-            PlayMusicStream(phone->music.library[phone->music.currentSongIdx].stream);
-        }
-    }
-
     // Album Art Placeholder (Dynamic Color based on Title Hash)
     int colorSeed = 0;
     for(int i = 0; s->title[i]; i++) colorSeed += s->title[i];
@@ -379,7 +380,8 @@ void DrawAppMusic(PhoneState *phone, Vector2 mouse, bool click) {
     DrawText(s->artist, 20, 310, 18, GRAY);
 
     // Progress Bar
-    float timePlayed = GetMusicTimePlayed(s->stream);
+    MusicPlayerStatus status = GetMusicPlayerStatus();
+    float timePlayed = (status.trackIndex == phone->music.currentSongIdx) ? status.timePlayed : 0.0f;
     float progress = 0.0f;
     if (s->duration > 0) progress = timePlayed / s->duration;
     
@@ -398,12 +400,11 @@ void DrawAppMusic(PhoneState *phone, Vector2 mouse, bool click) {
 
     // PREV
     if (GuiButton(btnPrev, "|<", DARKBLUE, mouse, click)) {
-        StopMusicStream(s->stream); 
         phone->music.isPlaying = true; 
         phone->music.currentSongIdx--;
         // Dynamic Wrap-around
         if(phone->music.currentSongIdx < 0) phone->music.currentSongIdx = phone->music.songCount - 1; 
-        PlayMusicStream(phone->music.library[phone->music.currentSongIdx].stream);
+        PlayMusicTrack(phone->music.currentSongIdx);
     }
     
     // PLAY/PAUSE
@@ -412,18 +413,18 @@ void DrawAppMusic(PhoneState *phone, Vector2 mouse, bool click) {
     
     if (GuiButton(btnPlay, playIcon, playColor, mouse, click)) {
         phone->music.isPlaying = !phone->music.isPlaying;
-        if (phone->music.isPlaying) PlayMusicStream(s->stream); 
-        else PauseMusicStream(s->stream);
+        if (!phone->music.isPlaying) PauseMusic();
+        else if (status.trackIndex == phone->music.currentSongIdx) ResumeMusic();
+        else PlayMusicTrack(phone->music.currentSongIdx);
     }
 
     // NEXT
     if (GuiButton(btnNext, ">|", DARKBLUE, mouse, click)) {
-        StopMusicStream(s->stream); 
         phone->music.isPlaying = true; 
         phone->music.currentSongIdx++;
         // Dynamic Wrap-around
         if(phone->music.currentSongIdx >= phone->music.songCount) phone->music.currentSongIdx = 0; 
-        PlayMusicStream(phone->music.library[phone->music.currentSongIdx].stream);
+        PlayMusicTrack(phone->music.currentSongIdx);
     }
     
     // Song Counter
@@ -506,9 +507,10 @@ void DrawAppSettings(PhoneState *phone, Player *player, Vector2 mouse, bool clic
  * - phone: Pointer to PhoneState.
  * - player: Pointer to Player.
  * - map: Pointer to GameMap.
+ * - dt: Simulation delta time.
  * Returns: None.
  */
-void UpdatePhone(PhoneState *phone, Player *player, GameMap *map) {
+void UpdatePhone(PhoneState *phone, Player *player, GameMap *map, float dt) {
     if (IsKeyPressed(KEY_TAB)) phone->isOpen = !phone->isOpen;
     float target = phone->isOpen ? 1.0f : 0.0f;
     phone->slideAnim += (target - phone->slideAnim) * 0.1f;
@@ -524,12 +526,17 @@ void UpdatePhone(PhoneState *phone, Player *player, GameMap *map) {
         if (IsKeyPressed(KEY_SIX))   phone->currentApp = APP_CAR_MONITOR;
     }
 
-    if (phone->music.isPlaying) {
-        UpdateMusicStream(phone->music.library[phone->music.currentSongIdx].stream);
+    // Playback (buffer refills, auto-next) runs on the audio worker; mirror its state for the UI
+    UpdateMusicPlayer();
+    MusicPlayerStatus musicStatus = GetMusicPlayerStatus();
+    if (musicStatus.settled && musicStatus.trackIndex >= 0 && musicStatus.trackIndex < phone->music.songCount) {
+        phone->music.currentSongIdx = musicStatus.trackIndex;
+        phone->music.isPlaying = musicStatus.playing;
+        if (musicStatus.duration > 0.0f) phone->music.library[musicStatus.trackIndex].duration = musicStatus.duration;
     }
     
-    if (notifTimer > 0) notifTimer -= GetFrameTime();
-    UpdateDeliveryApp(phone, player, map);
+    if (notifTimer > 0) notifTimer -= dt;
+    UpdateDeliveryApp(phone, player, map, dt);
 
     // --- SCALED MOUSE CALCULATION ---
     float screenW = (float)GetScreenWidth();
@@ -575,6 +582,103 @@ void UpdatePhone(PhoneState *phone, Player *player, GameMap *map) {
     }
 }
 
+/*
+ * Description: FNV-1a over a block of memory, used to detect changes in data the phone displays.
+ * Parameters:
+ * - hash: Running hash value.
+ * - data: Bytes to mix in.
+ * - size: Number of bytes.
+ * Returns: The updated hash.
+ */
+static unsigned int HashPhoneBytes(unsigned int hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/*
+ * Description: Hashes every player/phone value shown by the non-animated apps.
+ * Parameters:
+ * - phone: Pointer to PhoneState.
+ * - player: Pointer to Player.
+ * Returns: The data hash.
+ */
+static unsigned int HashPhoneData(PhoneState *phone, Player *player) {
+    unsigned int h = 2166136261u;
+    h = HashPhoneBytes(h, phone->tasks, sizeof(phone->tasks));
+    h = HashPhoneBytes(h, &phone->settings, sizeof(phone->settings));
+    h = HashPhoneBytes(h, &phone->music.currentSongIdx, sizeof(phone->music.currentSongIdx));
+    h = HashPhoneBytes(h, &phone->music.songCount, sizeof(phone->music.songCount));
+    h = HashPhoneBytes(h, &phone->music.isPlaying, sizeof(phone->music.isPlaying));
+
+    h = HashPhoneBytes(h, &player->money, sizeof(player->money));
+    h = HashPhoneBytes(h, &player->totalEarnings, sizeof(player->totalEarnings));
+    h = HashPhoneBytes(h, &player->totalDeliveries, sizeof(player->totalDeliveries));
+    h = HashPhoneBytes(h, &player->transactionCount, sizeof(player->transactionCount));
+    h = HashPhoneBytes(h, &player->loadResistance, sizeof(player->loadResistance));
+    h = HashPhoneBytes(h, &player->insulationFactor, sizeof(player->insulationFactor));
+    h = HashPhoneBytes(h, player->ownedUpgrades, sizeof(player->ownedUpgrades));
+    // Car Monitor stats change on dealership upgrades and car swaps
+    float carStats[4] = { player->max_speed, player->acceleration, player->maxFuel, player->fuelConsumption };
+    h = HashPhoneBytes(h, carStats, sizeof(carStats));
+    bool pins[4] = { player->pinSpeed, player->pinFuel, player->pinGForce, player->pinThermometer };
+    h = HashPhoneBytes(h, pins, sizeof(pins));
+    return h;
+}
+
+/*
+ * Description: Decides whether the phone screen texture needs re-rendering this frame, and records
+ * the state it will be rendered with.
+ * Parameters:
+ * - phone: Pointer to PhoneState.
+ * - player: Pointer to Player.
+ * - localMouse: Mouse position relative to the screen, (-1,-1) when off it.
+ * - click: Click state.
+ * Returns: True if the screen must be redrawn.
+ */
+static bool UpdatePhoneScreenCache(PhoneState *phone, Player *player, Vector2 localMouse, bool click) {
+    bool dirty = !screenCache.valid || screenCache.redrawNext;
+    screenCache.redrawNext = false;
+
+    // Only format the clock when the minute rolls over
+    time_t now = time(NULL);
+    long minute = (long)(now / 60);
+    if (minute != screenCache.clockMinute) {
+        struct tm *tm_info = localtime(&now);
+        snprintf(screenCache.clockText, sizeof(screenCache.clockText), "%02d:%02d", tm_info->tm_hour, tm_info->tm_min);
+        screenCache.clockMinute = minute;
+        dirty = true;
+    }
+
+    if (phone->currentApp != screenCache.app) dirty = true;
+    if (localMouse.x != screenCache.mouse.x || localMouse.y != screenCache.mouse.y) dirty = true;
+    if (click && localMouse.x >= 0) {
+        dirty = true;
+        screenCache.redrawNext = true;
+    }
+
+    // Notification fade, plus one frame to clear it
+    bool notifying = (notifTimer > 0);
+    if (notifying || screenCache.wasNotifying) dirty = true;
+
+    // Continuously animated apps
+    if (phone->currentApp == APP_MAP) dirty = true;
+    if (phone->currentApp == APP_MUSIC && phone->music.isPlaying) dirty = true;
+
+    unsigned int dataHash = HashPhoneData(phone, player);
+    if (dataHash != screenCache.dataHash) dirty = true;
+
+    screenCache.valid = true;
+    screenCache.app = phone->currentApp;
+    screenCache.mouse = localMouse;
+    screenCache.wasNotifying = notifying;
+    screenCache.dataHash = dataHash;
+    return dirty;
+}
+
 /*
  * Description: Main rendering function for the phone, handling the render texture and bezel scaling.
  * Parameters:
@@ -608,63 +712,70 @@ void DrawPhone(PhoneState *phone, Player *player, GameMap *map, Vector2 localMou
     if (CheckCollisionPointRec(globalMouse, screenDest)) {
          localMouse.x = (globalMouse.x - screenDest.x) * (SCREEN_WIDTH / screenDest.width);
          localMouse.y = (globalMouse.y - screenDest.y) * (SCREEN_HEIGHT / screenDest.height);
+    } else {
+         localMouse = (Vector2){ -1, -1 };
     }
 
-    BeginTextureMode(phone->screenTexture);
-        ClearBackground(RAYWHITE);
+    // Fully slid off-screen: nothing to render or composite
+    if (phoneY >= screenH) return;
+
+    // Retained mode: reuse last frame's texture unless something on it changed
+    if (UpdatePhoneScreenCache(phone, player, localMouse, click)) {
+        // Minimap tiles for this frame's camera must be baked before the screen texture is bound
+        if (phone->currentApp == APP_MAP) PrepareMapsApp(map);
+
+        BeginTextureMode(phone->screenTexture);
+            ClearBackground(RAYWHITE);
         
-        if (phone->currentApp != APP_HOME) {
-            DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RAYWHITE);
-        }
+            if (phone->currentApp != APP_HOME) {
+                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RAYWHITE);
+            }
 
-        // 1. DRAW APPS
-        switch (phone->currentApp) {
-            case APP_HOME: DrawAppHome(phone, player, localMouse, click); break;
-            case APP_DELIVERY: DrawDeliveryApp(phone, player, map, localMouse, click); break;
-            case APP_BANK: DrawAppBank(phone, player); break; 
-            case APP_MAP: DrawMapsApp(map); break;
-            case APP_MUSIC: DrawAppMusic(phone, localMouse, click); break;
-            case APP_SETTINGS: DrawAppSettings(phone, player, localMouse, click); break; 
-            case APP_CAR_MONITOR: DrawCarMonitorApp(player, localMouse, click); break; 
-            default: break;
-        }
+            // 1. DRAW APPS
+            switch (phone->currentApp) {
+                case APP_HOME: DrawAppHome(phone, player, localMouse, click); break;
+                case APP_DELIVERY: DrawDeliveryApp(phone, player, map, localMouse, click); break;
+                case APP_BANK: DrawAppBank(phone, player); break; 
+                case APP_MAP: DrawMapsApp(map); break;
+                case APP_MUSIC: DrawAppMusic(phone, localMouse, click); break;
+                case APP_SETTINGS: DrawAppSettings(phone, player, localMouse, click); break; 
+                case APP_CAR_MONITOR: DrawCarMonitorApp(player, localMouse, click); break; 
+                default: break;
+            }
 
-        // 2. DRAW STATUS BAR
-        DrawRectangle(0, 0, SCREEN_WIDTH, 20, Fade(BLACK, 0.4f)); 
+            // 2. DRAW STATUS BAR
+            DrawRectangle(0, 0, SCREEN_WIDTH, 20, Fade(BLACK, 0.4f)); 
         
-        time_t t;
-        struct tm *tm_info;
-        time(&t);
-        tm_info = localtime(&t);
-        DrawText(TextFormat("%02d:%02d", tm_info->tm_hour, tm_info->tm_min), 10, 4, 10, WHITE);
-
-        int battX = SCREEN_WIDTH - 35;
-        DrawText("84%", battX - 30, 4, 10, WHITE); 
-        DrawRectangleLines(battX, 5, 20, 10, WHITE);
-        DrawRectangle(battX + 20, 7, 2, 6, WHITE);
-        DrawRectangle(battX + 2, 7, 14, 6, GREEN);
-
-        // 3. HOME BUTTON
-        Rectangle homeBtn = { SCREEN_WIDTH/2 - 50, SCREEN_HEIGHT - 30, 100, 10 };
-        Color homeColor = (CheckCollisionPointRec(localMouse, homeBtn)) ? BLACK : LIGHTGRAY;
-        DrawRectangleRec(homeBtn, homeColor);
+            DrawText(screenCache.clockText, 10, 4, 10, WHITE);
+
+            int battX = SCREEN_WIDTH - 35;
+            DrawText("84%", battX - 30, 4, 10, WHITE); 
+            DrawRectangleLines(battX, 5, 20, 10, WHITE);
+            DrawRectangle(battX + 20, 7, 2, 6, WHITE);
+            DrawRectangle(battX + 2, 7, 14, 6, GREEN);
+
+            // 3. HOME BUTTON
+            Rectangle homeBtn = { SCREEN_WIDTH/2 - 50, SCREEN_HEIGHT - 30, 100, 10 };
+            Color homeColor = (CheckCollisionPointRec(localMouse, homeBtn)) ? BLACK : LIGHTGRAY;
+            DrawRectangleRec(homeBtn, homeColor);
         
-        if (CheckCollisionPointRec(localMouse, homeBtn) && click) {
-            phone->currentApp = APP_HOME;
-        }
+            if (CheckCollisionPointRec(localMouse, homeBtn) && click) {
+                phone->currentApp = APP_HOME;
+            }
         
-        // 4. NOTIFICATIONS
-        if (notifTimer > 0) {
-            float alpha = (notifTimer > 0.5f) ? 1.0f : (notifTimer * 2.0f);
-            Rectangle notifRect = { 10, 30, SCREEN_WIDTH - 20, 50 };
-            DrawRectangleRounded(notifRect, 0.2f, 4, Fade(DARKGRAY, 0.95f * alpha));
-            DrawRectangleRoundedLines(notifRect, 0.2f, 4, Fade(notifColor, alpha));
-            DrawCircle(35, 55, 15, Fade(notifColor, alpha));
-            DrawText("NOTIFICATION", 60, 35, 10, Fade(GRAY, alpha));
-            DrawText(notifText, 60, 48, 18, Fade(WHITE, alpha));
-        }
+            // 4. NOTIFICATIONS
+            if (notifTimer > 0) {
+                float alpha = (notifTimer > 0.5f) ? 1.0f : (notifTimer * 2.0f);
+                Rectangle notifRect = { 10, 30, SCREEN_WIDTH - 20, 50 };
+                DrawRectangleRounded(notifRect, 0.2f, 4, Fade(DARKGRAY, 0.95f * alpha));
+                DrawRectangleRoundedLines(notifRect, 0.2f, 4, Fade(notifColor, alpha));
+                DrawCircle(35, 55, 15, Fade(notifColor, alpha));
+                DrawText("NOTIFICATION", 60, 35, 10, Fade(GRAY, alpha));
+                DrawText(notifText, 60, 48, 18, Fade(WHITE, alpha));
+            }
         
-    EndTextureMode();
+        EndTextureMode();
+    }
 
     DrawRectangle(phoneX + (10*scale), phoneY + (10*scale), currentPhoneW, currentPhoneH, Fade(BLACK, 0.5f)); 
     DrawRectangleRounded((Rectangle){phoneX, phoneY, currentPhoneW, currentPhoneH}, 0.1f, 10, (Color){30, 30, 30, 255});
@@ -690,7 +801,7 @@ void UnloadPhone(PhoneState *phone) {
     UnloadTexture(iconSettings);
     UnloadTexture(iconCar);
 
-    for(int i = 0; i < 3; i++) {
-        UnloadMusicStream(phone->music.library[i].stream);
-    }
+    // Stops the track and unloads every stream the worker holds
+    SetMusicPlaylist(NULL, 0);
+    phone->music.isPlaying = false;
 }
\ No newline at end of file
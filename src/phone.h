@@ -72,6 +72,11 @@ typedef struct DeliveryTask {
     double creationTime;   
     double refreshTimer;   
     char description[64];  
+
+    // Smart pickup/dropoff zones, resolved once per job (see CacheDeliveryZones)
+    Vector3 pickupZonePos;
+    Vector3 dropoffZonePos;
+    unsigned int zoneMapId; // GameMap.loadId the zones were computed for, 0 = not cached
 } DeliveryTask;
 
 // --- Music Data ---
@@ -81,8 +86,7 @@ typedef struct {
     char title[64];
     char artist[64];
     char filePath[128];
-    Music stream;
-    float duration;
+    float duration;         // 0 until the audio worker has opened the track
 } Song;
 
 typedef struct {
@@ -119,9 +123,10 @@ typedef struct PhoneState {
 
 // --- Functions ---
 void InitPhone(PhoneState *phone, GameMap *map); 
-void UpdatePhone(PhoneState *phone, Player *player, GameMap *map); 
+void UpdatePhone(PhoneState *phone, Player *player, GameMap *map, float dt); 
 void DrawPhone(PhoneState *phone, Player *player, GameMap *map, Vector2 mouse, bool click);
 void UnloadPhone(PhoneState *phone);
+void LoadMusicLibrary(PhoneState *phone);
 
 void ShowPhoneNotification(const char *text, Color color); 
 void ShowTutorialHelp(void); 
@@ -17,6 +17,7 @@
 #include "player.h"
 #include "raymath.h" 
 #include "save.h"
+#include "asset_cache.h"
 #include <math.h>
 #include <stdio.h>
 #include <string.h>
@@ -26,6 +27,15 @@
 #define BAR_MARGIN_X 20
 #define BAR_MARGIN_Y 20
 
+// --- Fixed-step physics ---
+#define PLAYER_PHYSICS_DT (1.0f / 120.0f)
+#define PLAYER_MAX_SUBSTEPS 8          // ~66ms of simulation per frame; slower frames drop the excess
+#define PLAYER_GFORCE_WINDOW_STEPS 2   // G-force is sampled over 1/60s, the rate the damage model was tuned at
+
+// --- Swept collision ---
+#define PLAYER_SLIDE_ITERATIONS 3      // Contacts resolved per step (wall, then a corner)
+#define PLAYER_CONTACT_SKIN 0.001f     // Gap left between the car and a wall after a hit
+
 // --- HELPER FUNCTIONS ---
 
 /*
@@ -67,40 +77,59 @@ void LoadPlayerContent(Player *player) {
     } else {
         sprintf(path, "resources/Playermodels/sedan.obj");
     }
-    player->model = LoadModel(path);
+    player->model = LoadModelCached(path);
 }
 
 // --- PHYSICS HELPERS ---
 
 /*
- * Description: Moves the player along a specific axis, checking for collisions with the map or traffic.
+ * Description: Moves the player by a swept-circle query against the map, sliding along walls on contact,
+ *              then checks traffic once at the destination.
  * Parameters:
  * - player: Pointer to the Player.
  * - map: Pointer to the GameMap.
  * - traffic: Pointer to the TrafficManager.
- * - moveAmount: Distance to move.
- * - axis: 1 for X-axis, 0 for Z-axis.
+ * - move: Movement for this physics step (x, z).
  * Returns: None.
  */
-void ResolveMovement(Player* player, GameMap* map, TrafficManager* traffic, float moveAmount, int axis) {
-    float testX = player->position.x;
-    float testZ = player->position.z;
-
-    if (axis == 1) testX += moveAmount;
-    else           testZ += moveAmount;
-
-    // Check Collisions
-    bool hitMap = CheckMapCollision(map, testX, testZ, player->radius, 0);
-    Vector3 hitCar = TrafficCollision(traffic, testX, testZ, player->radius);
-
-    // 1. Path Clear? Move.
-    if (!hitMap && hitCar.z == -1) {
-        if (axis == 1) player->position.x += moveAmount;
-        else           player->position.z += moveAmount;
-        return; 
+void ResolveMovement(Player* player, GameMap* map, TrafficManager* traffic, Vector2 move) {
+    Vector2 pos = { player->position.x, player->position.z };
+    Vector2 remaining = move;
+    float moveLen = Vector2Length(move);
+
+    // 1. Sweep against walls and events, sliding the leftover movement along each contact
+    bool hitWall = false;
+    float headOn = 0.0f; // Cosine between the travel direction and the first wall hit
+    for (int iter = 0; iter < PLAYER_SLIDE_ITERATIONS; iter++) {
+        float remainingLen = Vector2Length(remaining);
+        if (remainingLen < 0.0001f) break;
+
+        MapSweepHit hit = SweepMapCollision(map, pos, remaining, player->radius, false);
+        if (!hit.hit) {
+            pos = Vector2Add(pos, remaining);
+            break;
+        }
+
+        // Stop just short of the contact so the next sweep starts outside the wall
+        float t = hit.time - PLAYER_CONTACT_SKIN / remainingLen;
+        if (t < 0.0f) t = 0.0f;
+        pos = Vector2Add(pos, Vector2Scale(remaining, t));
+
+        if (!hitWall) {
+            hitWall = true;
+            headOn = -Vector2DotProduct(Vector2Scale(move, 1.0f / moveLen), hit.normal);
+            if (headOn < 0.0f) headOn = 0.0f;
+            if (headOn > 1.0f) headOn = 1.0f;
+        }
+
+        Vector2 rest = Vector2Scale(remaining, 1.0f - t);
+        float into = Vector2DotProduct(rest, hit.normal);
+        if (into < 0.0f) rest = Vector2Subtract(rest, Vector2Scale(hit.normal, into));
+        remaining = rest;
     }
 
-    // 2. Car Crash? Bounce.
+    // 2. Car Crash? Bounce (one query at the destination).
+    Vector3 hitCar = TrafficCollision(traffic, pos.x, pos.y, player->radius);
     if (hitCar.z != -1) {
         float trafficSpeed = hitCar.z;
         float impactSpeed = fabsf(player->current_speed - trafficSpeed);
@@ -111,21 +140,58 @@ void ResolveMovement(Player* player, GameMap* map, TrafficManager* traffic, floa
             if (player->health < 0) player->health = 0;
         }
         player->current_speed *= -0.4f; 
-    } 
-    // 3. Wall Crash? Hard Stop.
-    else {
-        // Impact Damage
-        if (fabs(player->current_speed) > 8.0f) { 
-            int damage = (int)((fabs(player->current_speed) - 8.0f) * 3.0f);
+        return;
+    }
+
+    player->position.x = pos.x;
+    player->position.z = pos.y;
+
+    // 3. Wall Crash? Damage from the speed into the wall, keep the part along it.
+    if (hitWall) {
+        float impactSpeed = fabsf(player->current_speed) * headOn;
+        if (impactSpeed > 8.0f) { 
+            int damage = (int)((impactSpeed - 8.0f) * 3.0f);
             player->health -= damage;
             if (player->health < 0) player->health = 0;
         }
         
-        // Kill momentum instantly (No sliding)
-        player->current_speed = 0.0f;
+        // Head-on kills momentum, a glancing hit slides
+        player->current_speed *= sqrtf(1.0f - headOn * headOn);
     }
 }
 
+// --- INPUT ---
+
+static PlayerInput inputOverride = {0};
+static bool inputOverrideActive = false;
+
+/*
+ * Description: Samples the driving keys (WASD). Returns no input while the maps app search box has focus.
+ * Parameters: None.
+ * Returns: The current PlayerInput.
+ */
+PlayerInput ReadPlayerInput(void) {
+    PlayerInput input = {0};
+    if (IsMapsAppTyping()) return input;
+
+    input.gas = IsKeyDown(KEY_W);
+    input.reverse = IsKeyDown(KEY_S);
+    input.left = IsKeyDown(KEY_A);
+    input.right = IsKeyDown(KEY_D);
+    return input;
+}
+
+/*
+ * Description: Replaces the keyboard as the input source for UpdatePlayer (scripted drives, headless runs).
+ * Parameters:
+ * - input: Input to use on every following update, or NULL to read the keyboard again.
+ * Returns: None.
+ */
+void SetPlayerInputOverride(const PlayerInput *input) {
+    inputOverrideActive = (input != NULL);
+    if (input) inputOverride = *input;
+}
+
 // --- MAIN FUNCTIONS ---
 
 /*
@@ -180,6 +246,8 @@ Player InitPlayer(Vector3 startPos) {
     p.money = 0.0f;
     p.transactionCount = 0;
     AddMoney(&p, "Initial Funds", 100.00f);
+
+    SnapPlayerState(&p);
     
     return p;
 }
@@ -187,19 +255,16 @@ Player InitPlayer(Vector3 startPos) {
 
 
 /*
- * Description: Updates player physics, inputs, movement, and fuel consumption for the current frame.
+ * Description: Advances steering, throttle, movement, collision and fuel by one fixed physics step.
  * Parameters:
  * - player: Pointer to the Player.
  * - map: Pointer to the GameMap.
  * - traffic: Pointer to the TrafficManager.
- * - dt: Delta Time.
+ * - input: Driving input for this frame.
+ * - dt: Step length (PLAYER_PHYSICS_DT).
  * Returns: None.
  */
-void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float dt) {
-    if (dt > 0.04f) dt = 0.04f; 
-    
-    bool inputBlocked = IsMapsAppTyping();
-
+static void StepPlayerPhysics(Player *player, GameMap *map, TrafficManager *traffic, PlayerInput input, float dt) {
     // Force Physics Constants to defaults if needed
     player->friction = 0.995f; 
     if (player->brake_power > 12.0f) player->brake_power = 12.0f; 
@@ -207,10 +272,8 @@ void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float d
 
     // 1. STEERING
     float steerInput = 0.0f;
-    if (!inputBlocked) {
-        if (IsKeyDown(KEY_A)) steerInput = 1.0f;
-        if (IsKeyDown(KEY_D)) steerInput = -1.0f;
-    }
+    if (input.left) steerInput = 1.0f;
+    if (input.right) steerInput = -1.0f;
 
     if (steerInput != 0.0f) {
         player->steering_val += steerInput * 4.0f * dt;
@@ -228,7 +291,7 @@ void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float d
     if (player->steering_val < -1.0f) player->steering_val = -1.0f;
 
     // Allow steering if moving OR trying to move (stuck fix)
-    bool attemptingMove = !inputBlocked && (IsKeyDown(KEY_W) || IsKeyDown(KEY_S));
+    bool attemptingMove = input.gas || input.reverse;
     if (fabs(player->current_speed) > 0.1f || attemptingMove) {
         float turnFactor = player->steering_val * player->turn_speed * dt * 50.0f;
         player->angle += turnFactor;
@@ -239,8 +302,8 @@ void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float d
     float brake = player->brake_power;
     float friction = player->friction;
     
-    bool gas = !inputBlocked && IsKeyDown(KEY_W);
-    bool reverse = !inputBlocked && IsKeyDown(KEY_S);
+    bool gas = input.gas;
+    bool reverse = input.reverse;
     
     // A. GAS (W)
     if (gas) {
@@ -266,7 +329,8 @@ void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float d
     }
     // C. COASTING (No Input)
     else {
-        player->current_speed *= friction;
+        // Friction was tuned as a per-frame factor at 60 FPS
+        player->current_speed *= powf(friction, dt * 60.0f);
         if (fabs(player->current_speed) < 0.2f) player->current_speed = 0.0f;
     }
 
@@ -278,19 +342,14 @@ void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float d
     if (player->current_speed < maxRev) player->current_speed = maxRev;
 
     // 3. MOVEMENT APPLICATION
+    // [OPTIMIZATION] No tunneling cap needed: the collision query is swept
     float moveDist = player->current_speed * dt;
-    
-    // Safety cap to prevent tunneling
-    if (moveDist > 1.5f) moveDist = 1.5f;
-    if (moveDist < -1.5f) moveDist = -1.5f;
 
-    float moveX = sinf(player->angle * DEG2RAD) * moveDist;
-    float moveZ = cosf(player->angle * DEG2RAD) * moveDist;
+    Vector2 move = { sinf(player->angle * DEG2RAD) * moveDist, cosf(player->angle * DEG2RAD) * moveDist };
 
     Vector3 startPos = player->position;
 
-    ResolveMovement(player, map, traffic, moveX, 1);
-    ResolveMovement(player, map, traffic, moveZ, 0);
+    ResolveMovement(player, map, traffic, move);
 
     // Keep car grounded
     if (fabsf(player->position.y - startPos.y) > 0.1f) {
@@ -308,6 +367,97 @@ void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float d
     }
 }
 
+/*
+ * Description: Velocity vector on the ground plane, from speed and heading.
+ * Parameters:
+ * - player: Pointer to the Player.
+ * Returns: The velocity (x, z).
+ */
+static Vector2 GetPlayerVelocity(const Player *player) {
+    float rad = player->angle * DEG2RAD;
+    return (Vector2){ sinf(rad) * player->current_speed, cosf(rad) * player->current_speed };
+}
+
+/*
+ * Description: Updates player physics at a fixed 120 Hz, running as many steps as the frame time
+ *              covers, then interpolates renderPosition / renderAngle between the last two steps.
+ * Parameters:
+ * - player: Pointer to the Player.
+ * - map: Pointer to the GameMap.
+ * - traffic: Pointer to the TrafficManager.
+ * - dt: Frame delta time.
+ * Returns: None.
+ */
+void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float dt) {
+    PlayerInput input = inputOverrideActive ? inputOverride : ReadPlayerInput();
+
+    // Windows normally close on a frame boundary. Re-basing here keeps speed changed outside the
+    // physics (UI lock braking, border push) from reading as an impact.
+    Vector2 velocity = GetPlayerVelocity(player);
+    if (player->gForceWindowSteps == 0) player->gForceRefVelocity = velocity;
+
+    player->physicsAccumulator += dt;
+
+    int steps = 0;
+    while (player->physicsAccumulator >= PLAYER_PHYSICS_DT && steps < PLAYER_MAX_SUBSTEPS) {
+        player->prevPosition = player->position;
+        player->prevAngle = player->angle;
+
+        StepPlayerPhysics(player, map, traffic, input, PLAYER_PHYSICS_DT);
+        player->physicsAccumulator -= PLAYER_PHYSICS_DT;
+        steps++;
+
+        // G-force over a fixed window, so the reading does not depend on the frame rate
+        if (++player->gForceWindowSteps >= PLAYER_GFORCE_WINDOW_STEPS) {
+            velocity = GetPlayerVelocity(player);
+            float windowTime = PLAYER_GFORCE_WINDOW_STEPS * PLAYER_PHYSICS_DT;
+            float g = (Vector2Length(Vector2Subtract(velocity, player->gForceRefVelocity)) / windowTime) * 0.02f;
+            if (g > player->gForce) player->gForce = g;
+
+            player->gForceRefVelocity = velocity;
+            player->gForceWindowSteps = 0;
+        }
+    }
+
+    // Spiral-of-death guard: a hitch longer than the substep budget is dropped, not caught up
+    if (steps == PLAYER_MAX_SUBSTEPS && player->physicsAccumulator > PLAYER_PHYSICS_DT) {
+        player->physicsAccumulator = PLAYER_PHYSICS_DT;
+    }
+
+    float alpha = player->physicsAccumulator / PLAYER_PHYSICS_DT;
+    if (alpha > 1.0f) alpha = 1.0f;
+    player->renderPosition = Vector3Lerp(player->prevPosition, player->position, alpha);
+    player->renderAngle = Lerp(player->prevAngle, player->angle, alpha);
+}
+
+/*
+ * Description: Syncs the interpolation and G-force state after the player was moved outside
+ *              UpdatePlayer (spawn, load, respawn, border push), so nothing lerps across the jump.
+ * Parameters:
+ * - player: Pointer to the Player.
+ * Returns: None.
+ */
+void SnapPlayerState(Player *player) {
+    player->prevPosition = player->position;
+    player->prevAngle = player->angle;
+    player->renderPosition = player->position;
+    player->renderAngle = player->angle;
+    player->gForceRefVelocity = GetPlayerVelocity(player);
+    player->gForceWindowSteps = 0;
+}
+
+/*
+ * Description: Returns the peak G-force since the last call and starts a new measurement.
+ * Parameters:
+ * - player: Pointer to the Player.
+ * Returns: Peak G over the fixed windows simulated since the previous call.
+ */
+float ConsumePlayerGForce(Player *player) {
+    float g = player->gForce;
+    player->gForce = 0.0f;
+    return g;
+}
+
 /*
  * Description: Renders the health bar UI element.
  * Parameters:
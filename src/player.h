@@ -32,6 +32,14 @@ typedef struct Transaction {
     float amount; 
 } Transaction;
 
+// --- Driving Input ---
+typedef struct PlayerInput {
+    bool gas;       // W
+    bool reverse;   // S
+    bool left;      // A
+    bool right;     // D
+} PlayerInput;
+
 // --- Player Structure ---
 typedef struct Player {
     Vector3 position;
@@ -57,6 +65,9 @@ typedef struct Player {
     float physicsAccumulator;
     Vector3 renderPosition; // <--- DRAW THIS ONE
     float renderAngle;
+    float gForce;              // Peak G since the last ConsumePlayerGForce (measured over fixed 1/60s windows)
+    Vector2 gForceRefVelocity; // Velocity at the start of the current G window
+    int gForceWindowSteps;
     
     // Rendering
     Model model;
@@ -98,6 +109,10 @@ extern bool checkcamera_collision;
 Player InitPlayer(Vector3 startPos);
 void LoadPlayerContent(Player *player);
 void UpdatePlayer(Player *player, GameMap *map, TrafficManager *traffic, float dt);
+void SnapPlayerState(Player *player);      // After teleports: resets interpolation and the G window
+float ConsumePlayerGForce(Player *player);
+PlayerInput ReadPlayerInput(void);
+void SetPlayerInputOverride(const PlayerInput *input); // NULL = back to keyboard
 void DrawHealthBar(Player *player);
 void AddMoney(Player *player, const char* desc, float amount);
 
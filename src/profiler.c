@@ -0,0 +1,298 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+// clock_gettime needs POSIX visibility under strict -std=c17
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "profiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// NOTE: Like thread_pool.c, this file must not include raylib.h (windows.h clashes with it).
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#if defined(_MSC_VER)
+    #define PROFILER_TLS __declspec(thread)
+#else
+    #define PROFILER_TLS _Thread_local
+#endif
+
+#ifdef ENABLE_PROFILER
+
+typedef struct {
+    const char *name;
+    double start;   // Seconds
+    double end;
+} ProfileEvent;
+
+typedef struct {
+    ProfileEvent events[PROFILER_RING_EVENTS];
+    unsigned int written;   // Total completed zones (ring index = written % size)
+    int depth;
+    const char *openNames[PROFILER_MAX_DEPTH];
+    double openStarts[PROFILER_MAX_DEPTH];
+    char threadName[PROFILER_THREAD_NAME_LEN];  // Empty until named, "" slots dump as "Thread N"
+    bool used;              // Ever claimed: included in dumps
+} ProfileThreadBuffer;
+
+static ProfileThreadBuffer threadBuffers[PROFILER_MAX_THREADS];
+static volatile long slotOwned[PROFILER_MAX_THREADS];  // 1 while a live thread writes the slot
+static volatile long slotLocks[PROFILER_MAX_THREADS];  // Guards written, events and threadName against the dump
+static PROFILER_TLS ProfileThreadBuffer *localBuffer = NULL;
+static PROFILER_TLS bool localBufferFull = false;  // More threads than slots: stop trying
+
+/*
+ * Description: Monotonic high resolution clock.
+ * Parameters: None.
+ * Returns: Time in seconds.
+ */
+static double ProfilerNow(void) {
+#if defined(_WIN32)
+    static LARGE_INTEGER freq = { 0 };
+    LARGE_INTEGER counter;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+/*
+ * Description: Atomically takes ownership of a free slot.
+ * Parameters:
+ * - slot: Slot index.
+ * Returns: True if the caller now owns the slot.
+ */
+static bool TryClaimSlot(int slot) {
+#if defined(_WIN32)
+    return InterlockedCompareExchange(&slotOwned[slot], 1, 0) == 0;
+#else
+    long expected = 0;
+    return __atomic_compare_exchange_n(&slotOwned[slot], &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+#endif
+}
+
+/*
+ * Description: Spin lock around a slot's ring. Only ever contended while a dump copies the ring,
+ * so the recording threads pay one uncontended exchange per zone.
+ * Parameters:
+ * - slot: Slot index.
+ * Returns: None.
+ */
+static void LockSlot(int slot) {
+#if defined(_WIN32)
+    while (InterlockedExchange(&slotLocks[slot], 1) != 0) YieldProcessor();
+#else
+    while (__atomic_exchange_n(&slotLocks[slot], 1, __ATOMIC_ACQUIRE) != 0) { }
+#endif
+}
+
+static void UnlockSlot(int slot) {
+#if defined(_WIN32)
+    InterlockedExchange(&slotLocks[slot], 0);
+#else
+    __atomic_store_n(&slotLocks[slot], 0, __ATOMIC_RELEASE);
+#endif
+}
+
+/*
+ * Description: Returns the calling thread's buffer, claiming the lowest free slot on first use.
+ * A reused slot starts empty, so a trace never mixes zones of two threads under one name.
+ * Parameters: None.
+ * Returns: The buffer, or NULL if every slot is taken.
+ */
+static ProfileThreadBuffer* GetThreadBuffer(void) {
+    if (localBuffer || localBufferFull) return localBuffer;
+
+    for (int slot = 0; slot < PROFILER_MAX_THREADS; slot++) {
+        if (!TryClaimSlot(slot)) continue;
+        ProfileThreadBuffer *buf = &threadBuffers[slot];
+        LockSlot(slot);
+        buf->written = 0;
+        buf->depth = 0;
+        buf->threadName[0] = '\0';
+        buf->used = true;
+        UnlockSlot(slot);
+        localBuffer = buf;
+        return localBuffer;
+    }
+    localBufferFull = true;
+    return NULL;
+}
+
+/*
+ * Description: Labels the calling thread in traces. Only the first name is kept.
+ * Parameters:
+ * - name: Thread label (copied).
+ * Returns: None.
+ */
+void ProfilerSetThreadName(const char *name) {
+    ProfileThreadBuffer *buf = GetThreadBuffer();
+    if (!buf) return;
+
+    int slot = (int)(buf - threadBuffers);
+    LockSlot(slot);
+    if (buf->threadName[0] == '\0') snprintf(buf->threadName, sizeof(buf->threadName), "%s", name);
+    UnlockSlot(slot);
+}
+
+/*
+ * Description: Gives the calling thread's slot back. The zones stay readable by the dump
+ * until the next claim resets the slot.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfilerReleaseThread(void) {
+    ProfileThreadBuffer *buf = localBuffer;
+    localBuffer = NULL;
+    localBufferFull = false;
+    if (!buf) return;
+
+    int slot = (int)(buf - threadBuffers);
+#if defined(_WIN32)
+    InterlockedExchange(&slotOwned[slot], 0);
+#else
+    __atomic_store_n(&slotOwned[slot], 0, __ATOMIC_RELEASE);
+#endif
+}
+
+/*
+ * Description: Opens a zone on the calling thread.
+ * Parameters:
+ * - name: Zone label (must outlive the dump, use literals).
+ * Returns: None.
+ */
+void ProfilerBegin(const char *name) {
+    ProfileThreadBuffer *buf = GetThreadBuffer();
+    if (!buf) return;
+    if (buf->depth < PROFILER_MAX_DEPTH) {
+        buf->openNames[buf->depth] = name;
+        buf->openStarts[buf->depth] = ProfilerNow();
+    }
+    buf->depth++;
+}
+
+/*
+ * Description: Closes the innermost zone and records it in the thread's ring buffer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfilerEnd(void) {
+    ProfileThreadBuffer *buf = localBuffer;
+    if (!buf || buf->depth == 0) return;
+    buf->depth--;
+    if (buf->depth >= PROFILER_MAX_DEPTH) return; // Zone was too deep to track
+
+    ProfileEvent recorded = { buf->openNames[buf->depth], buf->openStarts[buf->depth], ProfilerNow() };
+    int slot = (int)(buf - threadBuffers);
+    LockSlot(slot);
+    buf->events[buf->written % PROFILER_RING_EVENTS] = recorded;
+    buf->written++;
+    UnlockSlot(slot);
+}
+
+/*
+ * Description: Writes the recent zones of every thread as a Chrome trace ("X" complete events).
+ *              Each ring is copied under its slot lock first, so threads that keep recording
+ *              during the dump never hand it half-written events.
+ * Parameters:
+ * - path: Output file.
+ * - seconds: How far back to go.
+ * Returns: True on success.
+ */
+bool ProfilerDumpTrace(const char *path, double seconds) {
+    ProfileEvent *copy = (ProfileEvent *)malloc(sizeof(ProfileEvent) * PROFILER_RING_EVENTS);
+    if (!copy) return false;
+
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        printf("PROFILER: Could not open %s\n", path);
+        free(copy);
+        return false;
+    }
+
+    double now = ProfilerNow();
+    double cutoff = now - seconds;
+
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    int total = 0;
+
+    for (int t = 0; t < PROFILER_MAX_THREADS; t++) {
+        ProfileThreadBuffer *buf = &threadBuffers[t];
+
+        // Snapshot the ring: everything written before this point, oldest first
+        char threadName[PROFILER_THREAD_NAME_LEN];
+        LockSlot(t);
+        bool used = buf->used;
+        unsigned int end = buf->written;
+        unsigned int begin = (end > PROFILER_RING_EVENTS) ? end - PROFILER_RING_EVENTS : 0;
+        int count = (int)(end - begin);
+        for (int i = 0; used && i < count; i++) copy[i] = buf->events[(begin + i) % PROFILER_RING_EVENTS];
+        memcpy(threadName, buf->threadName, sizeof(threadName));
+        UnlockSlot(t);
+        if (!used) continue;
+
+        if (threadName[0] != '\0') {
+            fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                    first ? "" : ",\n", t, threadName);
+        } else {
+            fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}}",
+                    first ? "" : ",\n", t, t);
+        }
+        first = false;
+
+        for (int i = 0; i < count; i++) {
+            ProfileEvent *ev = &copy[i];
+            if (ev->end < cutoff) continue;
+            // Timestamps relative to the dump window, in microseconds
+            fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    ev->name, t, (ev->start - cutoff) * 1e6, (ev->end - ev->start) * 1e6);
+            total++;
+        }
+    }
+
+    fprintf(f, "\n]}\n");
+    fclose(f);
+    free(copy);
+    printf("PROFILER: Wrote %d zones (last %.0fs) to %s\n", total, seconds, path);
+    return true;
+}
+
+#else
+
+// Profiling compiled out: keep the symbols so direct calls still link
+void ProfilerBegin(const char *name) { (void)name; }
+void ProfilerEnd(void) {}
+void ProfilerSetThreadName(const char *name) { (void)name; }
+void ProfilerReleaseThread(void) {}
+bool ProfilerDumpTrace(const char *path, double seconds) {
+    (void)path; (void)seconds;
+    return false;
+}
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include "thread_pool.h"
+
+// Scoped CPU zone profiler. Each thread records completed zones into its own
+// ring buffer; ProfilerDumpTrace writes them out as Chrome/Perfetto trace JSON
+// (open with chrome://tracing or ui.perfetto.dev).
+//
+// Build without ENABLE_PROFILER (premake: --profiler=off) and every macro
+// below compiles to nothing.
+
+#define PROFILER_BACKGROUND_THREADS 4   // Live non-pool threads that record zones (map loader, ...)
+#define PROFILER_MAX_THREADS (1 + MAX_POOL_WORKERS + PROFILER_BACKGROUND_THREADS)
+#define PROFILER_THREAD_NAME_LEN 32
+#define PROFILER_RING_EVENTS 32768      // Completed zones kept per thread
+#define PROFILER_MAX_DEPTH 32           // Nesting depth per thread
+
+#ifdef ENABLE_PROFILER
+    // name must be a string literal (or otherwise outlive the dump)
+    #define PROFILE_BEGIN(name)             ProfilerBegin(name)
+    #define PROFILE_END()                   ProfilerEnd()
+    #define PROFILE_DUMP(path, seconds)     ProfilerDumpTrace(path, seconds)
+    #define PROFILE_THREAD_NAME(name)       ProfilerSetThreadName(name)
+#else
+    #define PROFILE_BEGIN(name)             ((void)0)
+    #define PROFILE_END()                   ((void)0)
+    #define PROFILE_DUMP(path, seconds)     ((void)0)
+    #define PROFILE_THREAD_NAME(name)       ((void)0)
+#endif
+
+void ProfilerBegin(const char *name);
+void ProfilerEnd(void);
+
+// Labels the calling thread in traces. The first name sticks, so a background
+// job that falls back to running inline does not relabel the main thread.
+void ProfilerSetThreadName(const char *name);
+
+// Hands the calling thread's slot back for reuse. Call right before a thread
+// exits; its zones stay in the trace until another thread claims the slot.
+void ProfilerReleaseThread(void);
+
+// Writes every zone that ended in the last `seconds` to a trace file.
+// Main thread only; other threads may keep recording while it runs.
+bool ProfilerDumpTrace(const char *path, double seconds);
+
+#endif
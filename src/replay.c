@@ -0,0 +1,427 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#include "replay.h"
+#include "delivery_app.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// --- CONSTANTS ---
+#define REPLAY_FILE_NAME "replay.rec"
+#define REPLAY_MAGIC 0x50524744u   // "DGRP"
+#define REPLAY_VERSION 2u
+
+// Per-frame key bits (driving keys first, then the action keys)
+#define REPLAY_BIT_GAS     (1u << 0)
+#define REPLAY_BIT_REVERSE (1u << 1)
+#define REPLAY_BIT_LEFT    (1u << 2)
+#define REPLAY_BIT_RIGHT   (1u << 3)
+#define REPLAY_BIT_E       (1u << 4)
+#define REPLAY_BIT_R       (1u << 5)
+#define REPLAY_BIT_ENTER   (1u << 6)
+#define REPLAY_BIT_F3      (1u << 7)
+#define REPLAY_BIT_E_HELD  (1u << 8)   // Hold-to-interact (pickup / dropoff)
+
+// Player state restored at the start of playback
+typedef struct ReplaySnapshot {
+    Vector3 position;
+    float angle;
+    float current_speed;
+    float yVelocity;
+    float steering_val;
+    float physicsAccumulator;
+    float fuel;
+    float health;
+    float money;
+    float gForce;
+    Vector2 gForceRefVelocity;
+    int gForceWindowSteps;
+} ReplaySnapshot;
+
+// World state the simulation reads besides the player. Follows ReplaySnapshot in the file,
+// then come DeliverySimState, the task array and the event array. The sizes reject replays
+// from a build with different structs, the seed replays recorded on another map.
+typedef struct ReplayWorldHeader {
+    uint32_t mapSeed;
+    uint32_t taskSize;
+    uint32_t taskCount;
+    uint32_t eventSize;
+    uint32_t eventCount;
+} ReplayWorldHeader;
+
+#define REPLAY_TASK_COUNT ((uint32_t)(sizeof(((PhoneState *)0)->tasks) / sizeof(DeliveryTask)))
+
+// One recorded frame. Stored packed on disk: dt (4) + seed (4) + keys (2) = 10 bytes.
+typedef struct ReplayFrame {
+    float dt;
+    uint32_t seed;
+    uint16_t keys;
+} ReplayFrame;
+
+// --- STATE ---
+static ReplayMode mode = REPLAY_OFF;
+static FILE *recordFile = NULL;
+static uint32_t sessionSeed = 0;
+static uint32_t frameIndex = 0;
+static uint16_t currentKeys = 0;
+
+static ReplayFrame *frames = NULL;
+static uint32_t frameCount = 0;
+
+// --- HELPER FUNCTIONS ---
+
+/*
+ * Description: Derives the RNG seed for a frame from the session seed (splitmix-style mix).
+ * Parameters:
+ * - seed: Session seed.
+ * - frame: Frame index.
+ * Returns: The seed to pass to SetRandomSeed for that frame.
+ */
+static uint32_t FrameSeed(uint32_t seed, uint32_t frame) {
+    uint32_t h = seed + frame * 0x9E3779B9u;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/*
+ * Description: Samples the driving and action keys into a key bit mask.
+ * Parameters: None.
+ * Returns: The key bits for this frame.
+ */
+static uint16_t SampleKeys(void) {
+    PlayerInput input = ReadPlayerInput();
+    uint16_t keys = 0;
+    if (input.gas) keys |= REPLAY_BIT_GAS;
+    if (input.reverse) keys |= REPLAY_BIT_REVERSE;
+    if (input.left) keys |= REPLAY_BIT_LEFT;
+    if (input.right) keys |= REPLAY_BIT_RIGHT;
+    if (IsKeyPressed(KEY_E)) keys |= REPLAY_BIT_E;
+    if (IsKeyPressed(KEY_R)) keys |= REPLAY_BIT_R;
+    if (IsKeyPressed(KEY_ENTER)) keys |= REPLAY_BIT_ENTER;
+    if (IsKeyPressed(KEY_F3)) keys |= REPLAY_BIT_F3;
+    if (IsKeyDown(KEY_E)) keys |= REPLAY_BIT_E_HELD;
+    return keys;
+}
+
+/*
+ * Description: Feeds the driving bits of a key mask to the player as its input source.
+ * Parameters:
+ * - keys: Key bits for this frame.
+ * Returns: None.
+ */
+static void ApplyDrivingKeys(uint16_t keys) {
+    PlayerInput input = {
+        .gas = (keys & REPLAY_BIT_GAS) != 0,
+        .reverse = (keys & REPLAY_BIT_REVERSE) != 0,
+        .left = (keys & REPLAY_BIT_LEFT) != 0,
+        .right = (keys & REPLAY_BIT_RIGHT) != 0
+    };
+    SetPlayerInputOverride(&input);
+}
+
+// --- MAIN FUNCTIONS ---
+
+/*
+ * Description: Starts recording a session to a replay file. The session seed, player pose, jobs,
+ *              map events and job timers go in the header; traffic and signals are reset so
+ *              playback starts from the same state.
+ * Parameters:
+ * - fileName: Output replay file.
+ * - player: Player whose state is snapshotted.
+ * - phone: Phone whose delivery jobs are snapshotted.
+ * - map: Map whose events are snapshotted.
+ * - traffic: Traffic manager to reset.
+ * Returns: True if the file was opened.
+ */
+bool StartReplayRecording(const char *fileName, const Player *player, const PhoneState *phone, const GameMap *map, TrafficManager *traffic) {
+    StopReplay();
+
+    recordFile = fopen(fileName, "wb");
+    if (!recordFile) {
+        printf("REPLAY: Could not open %s for writing\n", fileName);
+        return false;
+    }
+
+    sessionSeed = (uint32_t)time(NULL);
+    ReplaySnapshot snap = {
+        .position = player->position,
+        .angle = player->angle,
+        .current_speed = player->current_speed,
+        .yVelocity = player->yVelocity,
+        .steering_val = player->steering_val,
+        .physicsAccumulator = player->physicsAccumulator,
+        .fuel = player->fuel,
+        .health = player->health,
+        .money = player->money,
+        .gForce = player->gForce,
+        .gForceRefVelocity = player->gForceRefVelocity,
+        .gForceWindowSteps = player->gForceWindowSteps
+    };
+    ReplayWorldHeader world = { map->seed, sizeof(DeliveryTask), REPLAY_TASK_COUNT, sizeof(MapEvent), MAX_EVENTS };
+    DeliverySimState sim = GetDeliverySimState();
+
+    // Frame count is patched in when the recording stops
+    uint32_t header[4] = { REPLAY_MAGIC, REPLAY_VERSION, sessionSeed, 0 };
+    fwrite(header, sizeof(uint32_t), 4, recordFile);
+    fwrite(&snap, sizeof(ReplaySnapshot), 1, recordFile);
+    fwrite(&world, sizeof(ReplayWorldHeader), 1, recordFile);
+    fwrite(&sim, sizeof(DeliverySimState), 1, recordFile);
+    fwrite(phone->tasks, sizeof(DeliveryTask), REPLAY_TASK_COUNT, recordFile);
+    fwrite(map->events, sizeof(MapEvent), MAX_EVENTS, recordFile);
+
+    InitTraffic(traffic);
+    frameIndex = 0;
+    mode = REPLAY_RECORDING;
+    printf("REPLAY: Recording -> %s (seed %u)\n", fileName, sessionSeed);
+    return true;
+}
+
+/*
+ * Description: Loads a replay file and restores its starting state. The recorded frames then
+ *              drive dt, the RNG and the keys until the file runs out.
+ * Parameters:
+ * - fileName: Replay file to play.
+ * - player: Player to restore.
+ * - phone: Phone whose delivery jobs are restored.
+ * - map: Map whose events are restored (must be the map the replay was recorded on).
+ * - traffic: Traffic manager to reset.
+ * Returns: True if the file was valid and playback started.
+ */
+bool StartReplayPlayback(const char *fileName, Player *player, PhoneState *phone, GameMap *map, TrafficManager *traffic) {
+    StopReplay();
+
+    FILE *file = fopen(fileName, "rb");
+    if (!file) {
+        printf("REPLAY: Could not open %s\n", fileName);
+        return false;
+    }
+
+    uint32_t header[4] = { 0 };
+    ReplaySnapshot snap = { 0 };
+    ReplayWorldHeader world = { 0 };
+    if (fread(header, sizeof(uint32_t), 4, file) != 4 || header[0] != REPLAY_MAGIC || header[1] != REPLAY_VERSION ||
+        fread(&snap, sizeof(ReplaySnapshot), 1, file) != 1 ||
+        fread(&world, sizeof(ReplayWorldHeader), 1, file) != 1 ||
+        world.taskSize != sizeof(DeliveryTask) || world.taskCount != REPLAY_TASK_COUNT ||
+        world.eventSize != sizeof(MapEvent) || world.eventCount != MAX_EVENTS) {
+        printf("REPLAY: %s is not a valid replay (version %u expected)\n", fileName, REPLAY_VERSION);
+        fclose(file);
+        return false;
+    }
+    if (world.mapSeed != map->seed) {
+        printf("REPLAY: %s was recorded on a different map\n", fileName);
+        fclose(file);
+        return false;
+    }
+
+    // Read into temporaries so a truncated file leaves the running session untouched
+    DeliverySimState sim;
+    DeliveryTask tasks[REPLAY_TASK_COUNT];
+    MapEvent events[MAX_EVENTS];
+    if (fread(&sim, sizeof(DeliverySimState), 1, file) != 1 ||
+        fread(tasks, sizeof(DeliveryTask), REPLAY_TASK_COUNT, file) != REPLAY_TASK_COUNT ||
+        fread(events, sizeof(MapEvent), MAX_EVENTS, file) != MAX_EVENTS) {
+        printf("REPLAY: %s is truncated (world state)\n", fileName);
+        fclose(file);
+        return false;
+    }
+
+    sessionSeed = header[2];
+    frameCount = header[3];
+    frames = (ReplayFrame *)malloc(sizeof(ReplayFrame) * (frameCount > 0 ? frameCount : 1));
+    if (!frames) {
+        fclose(file);
+        return false;
+    }
+
+    uint32_t loaded = 0;
+    while (loaded < frameCount) {
+        ReplayFrame *f = &frames[loaded];
+        if (fread(&f->dt, sizeof(float), 1, file) != 1 ||
+            fread(&f->seed, sizeof(uint32_t), 1, file) != 1 ||
+            fread(&f->keys, sizeof(uint16_t), 1, file) != 1) break;
+        loaded++;
+    }
+    fclose(file);
+
+    if (loaded < frameCount) printf("REPLAY: %s is truncated (%u of %u frames)\n", fileName, loaded, frameCount);
+    frameCount = loaded;
+
+    player->position = snap.position;
+    player->angle = snap.angle;
+    player->current_speed = snap.current_speed;
+    player->yVelocity = snap.yVelocity;
+    player->steering_val = snap.steering_val;
+    player->physicsAccumulator = snap.physicsAccumulator;
+    player->fuel = snap.fuel;
+    player->health = snap.health;
+    player->money = snap.money;
+    player->gForce = snap.gForce;
+    player->gForceRefVelocity = snap.gForceRefVelocity;
+    player->gForceWindowSteps = snap.gForceWindowSteps;
+    SnapPlayerState(player);
+
+    memcpy(phone->tasks, tasks, sizeof(tasks));
+    for (uint32_t i = 0; i < REPLAY_TASK_COUNT; i++) phone->tasks[i].zoneMapId = 0; // Recomputed for this load
+    memcpy(map->events, events, sizeof(events));
+    SetDeliverySimState(&sim);
+
+    InitTraffic(traffic);
+    frameIndex = 0;
+    mode = REPLAY_PLAYING;
+    printf("REPLAY: Playing %s (%u frames, seed %u)\n", fileName, frameCount, sessionSeed);
+    return true;
+}
+
+/*
+ * Description: Ends the current recording or playback and hands input back to the keyboard.
+ * Parameters: None.
+ * Returns: None.
+ */
+void StopReplay(void) {
+    if (mode == REPLAY_RECORDING && recordFile) {
+        fseek(recordFile, 3 * sizeof(uint32_t), SEEK_SET);
+        fwrite(&frameIndex, sizeof(uint32_t), 1, recordFile);
+        fclose(recordFile);
+        recordFile = NULL;
+        printf("REPLAY: Recording stopped (%u frames)\n", frameIndex);
+    }
+    else if (mode == REPLAY_PLAYING) {
+        printf("REPLAY: Playback stopped (%u of %u frames)\n", frameIndex, frameCount);
+    }
+
+    if (frames) {
+        free(frames);
+        frames = NULL;
+    }
+    frameCount = 0;
+    currentKeys = 0;
+
+    if (mode != REPLAY_OFF) SetPlayerInputOverride(NULL);
+    mode = REPLAY_OFF;
+}
+
+/*
+ * Description: Records or plays back one frame: dt, RNG seed and key state.
+ * Parameters:
+ * - dt: The real frame time.
+ * Returns: The frame time the simulation should use (the recorded one during playback).
+ */
+float UpdateReplayFrame(float dt) {
+    if (mode == REPLAY_PLAYING && frameIndex >= frameCount) StopReplay();
+    if (mode == REPLAY_OFF) return dt;
+
+    uint32_t seed;
+    if (mode == REPLAY_RECORDING) {
+        seed = FrameSeed(sessionSeed, frameIndex);
+        currentKeys = SampleKeys();
+
+        fwrite(&dt, sizeof(float), 1, recordFile);
+        fwrite(&seed, sizeof(uint32_t), 1, recordFile);
+        fwrite(&currentKeys, sizeof(uint16_t), 1, recordFile);
+    } else {
+        ReplayFrame *f = &frames[frameIndex];
+        dt = f->dt;
+        seed = f->seed;
+        currentKeys = f->keys;
+    }
+
+    // Record and playback both drive the player from the same bits, so the two runs match
+    ApplyDrivingKeys(currentKeys);
+    SetRandomSeed(seed);
+    frameIndex++;
+    return dt;
+}
+
+/*
+ * Description: IsKeyPressed for the gameplay action keys. While playing, answers from the replay
+ *              so the session's interactions (refuel, rescue, respawn, mechanic) happen on the same frames.
+ * Parameters:
+ * - key: KEY_E, KEY_R, KEY_ENTER or KEY_F3 (any other key goes straight to IsKeyPressed).
+ * Returns: True if the key was pressed this frame.
+ */
+bool ReplayKeyPressed(int key) {
+    if (mode == REPLAY_OFF) return IsKeyPressed(key);
+
+    switch (key) {
+        case KEY_E: return (currentKeys & REPLAY_BIT_E) != 0;
+        case KEY_R: return (currentKeys & REPLAY_BIT_R) != 0;
+        case KEY_ENTER: return (currentKeys & REPLAY_BIT_ENTER) != 0;
+        case KEY_F3: return (currentKeys & REPLAY_BIT_F3) != 0;
+        default: return IsKeyPressed(key);
+    }
+}
+
+/*
+ * Description: IsKeyDown for the hold-to-interact key, taken from the replay while playing.
+ * Parameters:
+ * - key: KEY_E (any other key goes straight to IsKeyDown).
+ * Returns: True if the key is held this frame.
+ */
+bool ReplayKeyDown(int key) {
+    if (mode == REPLAY_OFF || key != KEY_E) return IsKeyDown(key);
+    return (currentKeys & REPLAY_BIT_E_HELD) != 0;
+}
+
+ReplayMode GetReplayMode(void) {
+    return mode;
+}
+
+/*
+ * Description: Handles the replay hotkeys.
+ * Parameters:
+ * - player: Player to snapshot or restore.
+ * - phone: Phone whose jobs are snapshotted or restored.
+ * - map: Map whose events are snapshotted or restored.
+ * - traffic: Traffic manager to reset when a session starts.
+ * Returns: None.
+ */
+void UpdateReplayHotkeys(Player *player, PhoneState *phone, GameMap *map, TrafficManager *traffic) {
+    if (IsKeyPressed(KEY_F9)) {
+        if (mode == REPLAY_RECORDING) StopReplay();
+        else StartReplayRecording(REPLAY_FILE_NAME, player, phone, map, traffic);
+    }
+
+    if (IsKeyPressed(KEY_F10)) {
+        if (mode == REPLAY_PLAYING) StopReplay();
+        else StartReplayPlayback(REPLAY_FILE_NAME, player, phone, map, traffic);
+    }
+}
+
+/*
+ * Description: Draws a small REC / REPLAY tag in the bottom-left corner while a session is active.
+ * Parameters: None.
+ * Returns: None.
+ */
+void DrawReplayIndicator(void) {
+    if (mode == REPLAY_OFF) return;
+
+    const char *text = (mode == REPLAY_RECORDING)
+        ? TextFormat("REC %u (F9)", frameIndex)
+        : TextFormat("REPLAY %u / %u (F10)", frameIndex, frameCount);
+    int y = GetScreenHeight() - 30;
+
+    DrawRectangle(10, y, MeasureText(text, 10) + 20, 20, Fade(BLACK, 0.7f));
+    DrawText(text, 20, y + 5, 10, (mode == REPLAY_RECORDING) ? RED : GREEN);
+}
@@ -0,0 +1,53 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "player.h"
+#include "traffic.h"
+#include "phone.h"
+#include "map.h"
+
+typedef enum {
+    REPLAY_OFF = 0,
+    REPLAY_RECORDING,
+    REPLAY_PLAYING
+} ReplayMode;
+
+// Starts a session from a known state: the player pose, delivery jobs, map events and job
+// timers are snapshotted (recording) or restored (playback), traffic and signals are reset
+// and the RNG is reseeded.
+bool StartReplayRecording(const char *fileName, const Player *player, const PhoneState *phone, const GameMap *map, TrafficManager *traffic);
+bool StartReplayPlayback(const char *fileName, Player *player, PhoneState *phone, GameMap *map, TrafficManager *traffic);
+void StopReplay(void);
+
+// Call once at the top of the frame. Records or plays back the frame's dt, RNG seed
+// and keys, and returns the dt the simulation should use.
+float UpdateReplayFrame(float dt);
+
+// IsKeyPressed for the gameplay action keys (E, R, ENTER, F3), taken from the replay while playing
+bool ReplayKeyPressed(int key);
+// IsKeyDown for the hold-to-interact key (E)
+bool ReplayKeyDown(int key);
+
+ReplayMode GetReplayMode(void);
+
+// F9 toggles recording, F10 toggles playback (replay.rec)
+void UpdateReplayHotkeys(Player *player, PhoneState *phone, GameMap *map, TrafficManager *traffic);
+void DrawReplayIndicator(void);
+
+#endif
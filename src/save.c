@@ -15,11 +15,115 @@
  */
 
 #include "save.h"
+#include "asset_cache.h"
+#include "delivery_app.h"
+#include "thread_pool.h"
+#include "music_player.h"
 #include <stdio.h>
+#include <stdint.h>
 #include <string.h> 
 
 const unsigned char KEY = 0xAA; 
 
+#define SAVE_TEMP_FILE_NAME SAVE_FILE_NAME ".tmp"
+#define AUTOSAVE_INTERVAL 60.0f     // Seconds without any save before an autosave
+
+// --- CHUNKED FILE FORMAT ---
+// [SaveFileHeader] followed by [SaveChunkHeader][payload] blocks, every byte XOR'd with KEY.
+// Readers skip unknown tags and copy min(stored, compiled) bytes of each record, so new fields
+// (appended to the end of a record) and new chunks load fine in older builds and vice versa.
+// WRLD is written before the world chunks (TASK/EVNT/TRAF), which are only applied on the same map.
+#define SAVE_MAGIC 0x56534744u      // "DGSV"
+#define SAVE_FORMAT_VERSION 3       // Version 2 was a bare GameSaveData dump (still readable)
+#define SAVE_TAG(a, b, c, d) ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+#define CHUNK_PLAYER  SAVE_TAG('P', 'L', 'Y', 'R')
+#define CHUNK_WORLD   SAVE_TAG('W', 'R', 'L', 'D')
+#define CHUNK_TASKS   SAVE_TAG('T', 'A', 'S', 'K')
+#define CHUNK_EVENTS  SAVE_TAG('E', 'V', 'N', 'T')
+#define CHUNK_TRAFFIC SAVE_TAG('T', 'R', 'A', 'F')
+#define SAVE_IO_BUFFER 4096
+#define SAVE_TASK_SLOTS 5
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+} SaveFileHeader;
+
+typedef struct {
+    uint32_t tag;
+    uint32_t size;      // Payload bytes following this header
+} SaveChunkHeader;
+
+// Prefix of array chunks (TASK/EVNT/TRAF)
+typedef struct {
+    uint32_t count;
+    uint32_t recordSize;
+} SaveArrayHeader;
+
+// Identifies the map the world chunks were recorded on
+typedef struct {
+    int nodeCount;
+    int edgeCount;
+    int locationCount;
+} SaveWorldRecord;
+
+// DeliveryTask without the cached zones (recomputed on demand) and with times made session-relative
+typedef struct {
+    char restaurant[32];
+    Vector2 restaurantPos;
+    char customer[32];
+    Vector2 customerPos;
+    float pay;
+    float maxPay;
+    float distance;
+    int status;
+    int jobType;
+    float fragility;
+    int isHeavy;
+    float timeLimit;
+    double age;             // GetDeliveryClock() - creationTime at save
+    double refreshTimer;
+    char description[64];
+} SaveTaskRecord;
+
+typedef struct {
+    int type;
+    Vector2 position;
+    float radius;
+    float timer;
+    char label[64];
+} SaveEventRecord;
+
+// Everything one save file holds, captured on the main thread
+typedef struct {
+    GameSaveData player;
+    bool hasWorld;
+    SaveWorldRecord world;
+    SaveTaskRecord tasks[SAVE_TASK_SLOTS];
+    int taskCount;
+    SaveEventRecord events[MAX_EVENTS];
+    int eventCount;
+    TrafficSaveRecord vehicles[MAX_VEHICLES];
+    int vehicleCount;
+} SaveSnapshot;
+
+// --- SAVE SERVICE ---
+// SaveGame packs a snapshot on the main thread; obfuscation and file I/O run on a
+// background job. Saves requested while a write is in flight coalesce (newest wins).
+typedef struct {
+    BackgroundJob *job;
+    SaveSnapshot writing;   // Owned by the writer job while it runs
+    SaveSnapshot pending;
+    bool hasPending;
+    float timeSinceSave;
+
+    SaveSnapshot loading;   // Main thread only (LoadGame / ReadSavedModelName)
+    GameMap *map;           // World bound with BindSaveWorld, NULL = player-only saves
+    TrafficManager *traffic;
+} SaveService;
+
+static SaveService saveService = {0};
+
 /*
  * Description: Applies a simple XOR obfuscation to a block of memory (used for save encryption/decryption).
  * Parameters:
@@ -34,121 +138,560 @@ void Obfuscate(unsigned char* data, size_t size) {
 }
 
 /*
- * Description: Serializes the current game state (player and phone data) into a binary file.
+ * Description: Copies the persistent game state into a save record (main thread, no I/O).
  * Parameters:
- * - player: Pointer to the Player struct containing physics, economy, and position data.
- * - phone: Pointer to PhoneState containing settings and app data.
- * Returns: True if the save was successful, false otherwise.
+ * - player: Player holding physics, economy, and position data.
+ * - phone: PhoneState holding settings.
+ * - data: Record to fill.
+ * Returns: None.
  */
-bool SaveGame(Player *player, PhoneState *phone) {
-    GameSaveData data = {0};
-    
-    // 1. PACK DATA
-    data.version = SAVE_VERSION;
+static void PackSaveData(const Player *player, const PhoneState *phone, GameSaveData *data) {
+    *data = (GameSaveData){0};
+    data->version = SAVE_VERSION;
     
     // Position
-    data.position = player->position;
-    data.angle = player->angle;
+    data->position = player->position;
+    data->angle = player->angle;
     
     // Car Stats
-    strcpy(data.modelFileName, player->currentModelFileName);
-    data.max_speed = player->max_speed;
-    data.acceleration = player->acceleration;
-    data.brake_power = player->brake_power;
-    data.maxFuel = player->maxFuel;
-    data.fuelConsumption = player->fuelConsumption;
-    data.insulationFactor = player->insulationFactor;
-    data.loadResistance = player->loadResistance;
+    strcpy(data->modelFileName, player->currentModelFileName);
+    data->max_speed = player->max_speed;
+    data->acceleration = player->acceleration;
+    data->brake_power = player->brake_power;
+    data->maxFuel = player->maxFuel;
+    data->fuelConsumption = player->fuelConsumption;
+    data->insulationFactor = player->insulationFactor;
+    data->loadResistance = player->loadResistance;
 
     // Garage Persistence
     for(int i = 0; i < 10; i++) {
-        data.ownedCars[i] = player->ownedCars[i];
-        data.ownedUpgrades[i] = player->ownedUpgrades[i];
+        data->ownedCars[i] = player->ownedCars[i];
+        data->ownedUpgrades[i] = player->ownedUpgrades[i];
     }
-    data.currentCarIndex = player->currentCarIndex;
-    data.isDrivingUpgrade = player->isDrivingUpgrade;
+    data->currentCarIndex = player->currentCarIndex;
+    data->isDrivingUpgrade = player->isDrivingUpgrade;
 
     // Resources
-    data.fuel = player->fuel;
-    data.health = player->health;
+    data->fuel = player->fuel;
+    data->health = player->health;
     
     // Economy
-    data.money = player->money;
-    data.totalDeliveries = player->totalDeliveries;
-    data.totalEarnings = player->totalEarnings;
-    data.transactionCount = player->transactionCount;
+    data->money = player->money;
+    data->totalDeliveries = player->totalDeliveries;
+    data->totalEarnings = player->totalEarnings;
+    data->transactionCount = player->transactionCount;
     
     for(int i = 0; i < MAX_TRANSACTIONS; i++) {
-        data.history[i] = player->history[i];
+        data->history[i] = player->history[i];
     }
     
     // UI Pins
-    data.pinSpeed = player->pinSpeed;
-    data.pinFuel = player->pinFuel;
-    data.pinGForce = player->pinGForce;
-    data.pinThermometer = player->pinThermometer;
+    data->pinSpeed = player->pinSpeed;
+    data->pinFuel = player->pinFuel;
+    data->pinGForce = player->pinGForce;
+    data->pinThermometer = player->pinThermometer;
 
     // Game Progress
-    data.tutorialFinished = player->tutorialFinished;
+    data->tutorialFinished = player->tutorialFinished;
 
     // Phone
-    data.settings = phone->settings;
+    data->settings = phone->settings;
+}
+
+/*
+ * Description: Captures the player record plus, when a world is bound, the delivery jobs, map events and traffic.
+ * Parameters:
+ * - player: Player to record.
+ * - phone: PhoneState holding settings and delivery jobs.
+ * - snap: Snapshot to fill.
+ * Returns: None.
+ */
+static void PackSnapshot(const Player *player, const PhoneState *phone, SaveSnapshot *snap) {
+    PackSaveData(player, phone, &snap->player);
+
+    snap->hasWorld = (saveService.map != NULL);
+    snap->taskCount = 0;
+    snap->eventCount = 0;
+    snap->vehicleCount = 0;
+    if (!snap->hasWorld) return;
+
+    GameMap *map = saveService.map;
+    snap->world = (SaveWorldRecord){ map->nodeCount, map->edgeCount, map->locationCount };
+
+    // Jobs
+    double now = GetDeliveryClock();
+    for (int i = 0; i < SAVE_TASK_SLOTS; i++) {
+        const DeliveryTask *t = &phone->tasks[i];
+        SaveTaskRecord *r = &snap->tasks[snap->taskCount++];
+        memset(r, 0, sizeof(*r));
+        memcpy(r->restaurant, t->restaurant, sizeof(r->restaurant));
+        r->restaurantPos = t->restaurantPos;
+        memcpy(r->customer, t->customer, sizeof(r->customer));
+        r->customerPos = t->customerPos;
+        r->pay = t->pay;
+        r->maxPay = t->maxPay;
+        r->distance = t->distance;
+        r->status = (int)t->status;
+        r->jobType = t->jobType;
+        r->fragility = t->fragility;
+        r->isHeavy = t->isHeavy;
+        r->timeLimit = t->timeLimit;
+        r->age = now - t->creationTime;
+        r->refreshTimer = t->refreshTimer;
+        memcpy(r->description, t->description, sizeof(r->description));
+    }
+
+    // Events
+    for (int i = 0; i < MAX_EVENTS; i++) {
+        const MapEvent *e = &map->events[i];
+        if (!e->active) continue;
+        SaveEventRecord *r = &snap->events[snap->eventCount++];
+        memset(r, 0, sizeof(*r));
+        r->type = (int)e->type;
+        r->position = e->position;
+        r->radius = e->radius;
+        r->timer = e->timer;
+        memcpy(r->label, e->label, sizeof(r->label));
+    }
+
+    // Traffic
+    if (saveService.traffic) {
+        snap->vehicleCount = PackTrafficState(saveService.traffic, snap->vehicles, MAX_VEHICLES);
+    }
+}
+
+// --- STREAMING I/O ---
+
+typedef struct {
+    FILE *file;
+    bool ok;
+} SaveWriter;
+
+/*
+ * Description: Obfuscates and writes a block through a small staging buffer (the source is left untouched).
+ * Parameters:
+ * - w: Writer; ok is cleared on the first failed write.
+ * - data: Bytes to write.
+ * - size: Number of bytes.
+ * Returns: None.
+ */
+static void WriteObfuscated(SaveWriter *w, const void *data, size_t size) {
+    unsigned char buffer[SAVE_IO_BUFFER];
+    const unsigned char *src = (const unsigned char *)data;
+
+    while (size > 0 && w->ok) {
+        size_t n = (size < sizeof(buffer)) ? size : sizeof(buffer);
+        memcpy(buffer, src, n);
+        Obfuscate(buffer, n);
+        w->ok = (fwrite(buffer, 1, n, w->file) == n);
+        src += n;
+        size -= n;
+    }
+}
+
+static void WriteChunk(SaveWriter *w, uint32_t tag, const void *data, uint32_t size) {
+    SaveChunkHeader header = { tag, size };
+    WriteObfuscated(w, &header, sizeof(header));
+    WriteObfuscated(w, data, size);
+}
+
+static void WriteArrayChunk(SaveWriter *w, uint32_t tag, const void *records, int count, uint32_t recordSize) {
+    SaveArrayHeader array = { (uint32_t)count, recordSize };
+    SaveChunkHeader header = { tag, (uint32_t)sizeof(array) + array.count * recordSize };
+    WriteObfuscated(w, &header, sizeof(header));
+    WriteObfuscated(w, &array, sizeof(array));
+    WriteObfuscated(w, records, array.count * recordSize);
+}
+
+/*
+ * Description: Reads and de-obfuscates a block.
+ * Returns: True if all bytes were read.
+ */
+static bool ReadObfuscated(FILE *file, void *dst, size_t size) {
+    if (size == 0) return true;
+    if (fread(dst, 1, size, file) != size) return false;
+    Obfuscate((unsigned char *)dst, size);
+    return true;
+}
+
+static bool SkipBytes(FILE *file, size_t size) {
+    return size == 0 || fseek(file, (long)size, SEEK_CUR) == 0;
+}
+
+/*
+ * Description: Reads a stored record into a (possibly larger or smaller) compiled struct.
+ * Bytes the file lacks keep the caller's defaults; bytes the build does not know are skipped.
+ * Parameters:
+ * - file: Open save file, positioned at the record.
+ * - dst: Destination struct, pre-filled with defaults.
+ * - dstSize: sizeof(*dst).
+ * - storedSize: Record size in the file.
+ * Returns: True on success.
+ */
+static bool ReadRecord(FILE *file, void *dst, size_t dstSize, size_t storedSize) {
+    size_t n = (storedSize < dstSize) ? storedSize : dstSize;
+    return ReadObfuscated(file, dst, n) && SkipBytes(file, storedSize - n);
+}
+
+/*
+ * Description: Reads an array chunk payload record by record (zero-filled defaults).
+ * Parameters:
+ * - file: Open save file, positioned at the payload.
+ * - chunkSize: Payload size from the chunk header.
+ * - dst: Destination array.
+ * - dstRecordSize: sizeof one destination element.
+ * - maxRecords: Capacity of dst; extra records are skipped.
+ * Returns: Number of records read, or -1 if the chunk is malformed.
+ */
+static int ReadArrayChunk(FILE *file, uint32_t chunkSize, void *dst, size_t dstRecordSize, int maxRecords) {
+    SaveArrayHeader array;
+    if (chunkSize < sizeof(array) || !ReadObfuscated(file, &array, sizeof(array))) return -1;
+
+    uint64_t payload = (uint64_t)array.count * array.recordSize;
+    if (payload > chunkSize - sizeof(array)) return -1;
+
+    int count = 0;
+    for (uint32_t i = 0; i < array.count; i++) {
+        if (count < maxRecords) {
+            void *record = (unsigned char *)dst + (size_t)count * dstRecordSize;
+            memset(record, 0, dstRecordSize);
+            if (!ReadRecord(file, record, dstRecordSize, array.recordSize)) return -1;
+            count++;
+        } else if (!SkipBytes(file, array.recordSize)) {
+            return -1;
+        }
+    }
+    return SkipBytes(file, chunkSize - sizeof(array) - (size_t)payload) ? count : -1;
+}
+
+/*
+ * Description: Streams a save file into a snapshot. Reads both the chunked format and the
+ * legacy version 2 flat dump. World chunks are kept only if they were saved on the given map.
+ * Parameters:
+ * - file: Open save file.
+ * - snap: Snapshot to fill; snap->player must hold defaults for fields the file lacks.
+ * - map: Map to match the world chunks against, NULL to skip them.
+ * Returns: True if a player record was read.
+ */
+static bool ReadSaveFile(FILE *file, SaveSnapshot *snap, const GameMap *map) {
+    snap->hasWorld = false;
+    snap->taskCount = 0;
+    snap->eventCount = 0;
+    snap->vehicleCount = 0;
+
+    SaveFileHeader header;
+    if (!ReadObfuscated(file, &header, sizeof(header))) return false;
+
+    if (header.magic != SAVE_MAGIC) {
+        // Legacy: the whole file is one GameSaveData
+        rewind(file);
+        GameSaveData legacy;
+        if (fread(&legacy, sizeof(legacy), 1, file) != 1) return false;
+        Obfuscate((unsigned char*)&legacy, sizeof(legacy));
+        if (legacy.version != SAVE_VERSION) {
+            TraceLog(LOG_WARNING, "SAVE: Save version mismatch (Old file?). Starting fresh.");
+            return false;
+        }
+        snap->player = legacy;
+        TraceLog(LOG_INFO, "SAVE: Read legacy save, world state will be regenerated.");
+        return true;
+    }
+    if (header.version > SAVE_FORMAT_VERSION) {
+        TraceLog(LOG_INFO, "SAVE: File is from a newer build (format %u), skipping unknown chunks.", header.version);
+    }
+
+    bool hasPlayer = false;
+    bool worldMatches = false;
+    SaveChunkHeader chunk;
+    while (ReadObfuscated(file, &chunk, sizeof(chunk))) {
+        bool ok = true;
+        int count = 0;
+
+        switch (chunk.tag) {
+            case CHUNK_PLAYER:
+                ok = ReadRecord(file, &snap->player, sizeof(snap->player), chunk.size);
+                hasPlayer = ok;
+                break;
+
+            case CHUNK_WORLD: {
+                SaveWorldRecord world = {0};
+                ok = ReadRecord(file, &world, sizeof(world), chunk.size);
+                worldMatches = ok && map && world.nodeCount == map->nodeCount &&
+                               world.edgeCount == map->edgeCount && world.locationCount == map->locationCount;
+                snap->hasWorld = worldMatches;
+                snap->world = world;
+                if (ok && map && !worldMatches) TraceLog(LOG_WARNING, "SAVE: World state is from another map, skipping it.");
+                break;
+            }
+
+            case CHUNK_TASKS:
+                if (!worldMatches) { ok = SkipBytes(file, chunk.size); break; }
+                count = ReadArrayChunk(file, chunk.size, snap->tasks, sizeof(SaveTaskRecord), SAVE_TASK_SLOTS);
+                ok = (count >= 0);
+                if (ok) snap->taskCount = count;
+                break;
 
-    // 2. ENCRYPT & WRITE
-    Obfuscate((unsigned char*)&data, sizeof(GameSaveData));
+            case CHUNK_EVENTS:
+                if (!worldMatches) { ok = SkipBytes(file, chunk.size); break; }
+                count = ReadArrayChunk(file, chunk.size, snap->events, sizeof(SaveEventRecord), MAX_EVENTS);
+                ok = (count >= 0);
+                if (ok) snap->eventCount = count;
+                break;
 
-    FILE *file = fopen(SAVE_FILE_NAME, "wb");
+            case CHUNK_TRAFFIC:
+                if (!worldMatches) { ok = SkipBytes(file, chunk.size); break; }
+                count = ReadArrayChunk(file, chunk.size, snap->vehicles, sizeof(TrafficSaveRecord), MAX_VEHICLES);
+                ok = (count >= 0);
+                if (ok) snap->vehicleCount = count;
+                break;
+
+            default:
+                ok = SkipBytes(file, chunk.size); // Chunk from a newer build
+                break;
+        }
+
+        if (!ok) {
+            // Keep what was read before the damage; drop world state that may be half-filled
+            TraceLog(LOG_WARNING, "SAVE: Truncated or damaged chunk, ignoring the rest of the file.");
+            snap->hasWorld = false;
+            break;
+        }
+    }
+    return hasPlayer;
+}
+
+/*
+ * Description: Streams a snapshot to a temp file, syncs it to disk, then renames it over the save
+ *              file so a failed write never leaves a truncated save behind.
+ * Parameters:
+ * - snap: Snapshot to write.
+ * Returns: True if the new save is in place.
+ */
+static bool WriteSaveFile(const SaveSnapshot *snap) {
+    FILE *file = fopen(SAVE_TEMP_FILE_NAME, "wb");
     if (!file) {
         TraceLog(LOG_ERROR, "SAVE: Could not open file for writing.");
         return false;
     }
 
-    size_t written = fwrite(&data, sizeof(GameSaveData), 1, file);
-    fclose(file);
+    SaveWriter w = { file, true };
+    SaveFileHeader header = { SAVE_MAGIC, SAVE_FORMAT_VERSION };
+    WriteObfuscated(&w, &header, sizeof(header));
+    WriteChunk(&w, CHUNK_PLAYER, &snap->player, sizeof(snap->player));
+    if (snap->hasWorld) {
+        WriteChunk(&w, CHUNK_WORLD, &snap->world, sizeof(snap->world));
+        WriteArrayChunk(&w, CHUNK_TASKS, snap->tasks, snap->taskCount, sizeof(SaveTaskRecord));
+        WriteArrayChunk(&w, CHUNK_EVENTS, snap->events, snap->eventCount, sizeof(SaveEventRecord));
+        WriteArrayChunk(&w, CHUNK_TRAFFIC, snap->vehicles, snap->vehicleCount, sizeof(TrafficSaveRecord));
+    }
 
-    if (written == 1) {
-        TraceLog(LOG_INFO, "SAVE: Game saved successfully.");
-        return true;
-    } else {
-        TraceLog(LOG_ERROR, "SAVE: Write failed.");
+    bool ok = w.ok;
+    ok = SyncFileToDisk(file) && ok;
+    ok = (fclose(file) == 0) && ok;
+
+    if (!ok || !ReplaceFileAtomic(SAVE_TEMP_FILE_NAME, SAVE_FILE_NAME)) {
+        TraceLog(LOG_ERROR, "SAVE: Write failed, previous save kept.");
+        remove(SAVE_TEMP_FILE_NAME);
         return false;
     }
+
+    TraceLog(LOG_INFO, "SAVE: Game saved successfully.");
+    return true;
+}
+
+static void SaveWriteTask(void *context) {
+    (void)context;
+    WriteSaveFile(&saveService.writing);
+}
+
+/*
+ * Description: Retires a finished write and starts the next pending one.
+ * Parameters:
+ * - wait: Block on the in-flight write instead of returning while it runs.
+ * Returns: None.
+ */
+static void PumpSaveService(bool wait) {
+    if (saveService.job) {
+        if (!wait && !IsBackgroundJobDone(saveService.job)) return;
+        FinishBackgroundJob(saveService.job);
+        saveService.job = NULL;
+    }
+
+    if (saveService.hasPending) {
+        saveService.writing = saveService.pending;
+        saveService.hasPending = false;
+        saveService.job = StartBackgroundJob(SaveWriteTask, NULL);
+        if (!saveService.job) WriteSaveFile(&saveService.writing);
+    }
+}
+
+/*
+ * Description: Snapshots the current game state (player, phone and bound world) and queues it for a background write.
+ * Parameters:
+ * - player: Pointer to the Player struct containing physics, economy, and position data.
+ * - phone: Pointer to PhoneState containing settings and app data.
+ * Returns: True once the snapshot is queued (write errors are logged by the writer).
+ */
+bool SaveGame(Player *player, PhoneState *phone) {
+    PackSnapshot(player, phone, &saveService.pending);
+    saveService.hasPending = true;
+    saveService.timeSinceSave = 0.0f;
+
+    PumpSaveService(false);
+    return true;
 }
 
 /*
- * Description: Reads the binary save file, decrypts it, and restores the game state.
+ * Description: Per-frame save housekeeping: finishes background writes and fires the periodic autosave.
+ * Parameters:
+ * - player: Pointer to the Player (autosave source).
+ * - phone: Pointer to the PhoneState (autosave source).
+ * - dt: Frame time in seconds.
+ * - allowAutosave: False while the state should not be persisted (dead, replay playback).
+ * Returns: None.
+ */
+void UpdateSaveService(Player *player, PhoneState *phone, float dt, bool allowAutosave) {
+    PumpSaveService(false);
+
+    saveService.timeSinceSave += dt;
+    if (allowAutosave && saveService.timeSinceSave >= AUTOSAVE_INTERVAL) {
+        TraceLog(LOG_INFO, "SAVE: Autosave.");
+        SaveGame(player, phone);
+    }
+}
+
+/*
+ * Description: Blocks until every queued save is on disk (before reading, deleting, or quitting).
+ * Parameters: None.
+ * Returns: None.
+ */
+void FlushSaves(void) {
+    while (saveService.job || saveService.hasPending) PumpSaveService(true);
+}
+
+/*
+ * Description: Restores the jobs, events and traffic from a snapshot onto the bound world.
+ * Parameters:
+ * - phone: PhoneState receiving the jobs.
+ * - snap: Snapshot read by ReadSaveFile.
+ * Returns: None.
+ */
+static void ApplyWorldState(PhoneState *phone, const SaveSnapshot *snap) {
+    double now = GetDeliveryClock();
+    for (int i = 0; i < snap->taskCount; i++) {
+        const SaveTaskRecord *r = &snap->tasks[i];
+        DeliveryTask *t = &phone->tasks[i];
+        memset(t, 0, sizeof(*t)); // zoneMapId = 0: zones are recomputed on first use
+        memcpy(t->restaurant, r->restaurant, sizeof(t->restaurant));
+        t->restaurant[sizeof(t->restaurant) - 1] = '\0';
+        t->restaurantPos = r->restaurantPos;
+        memcpy(t->customer, r->customer, sizeof(t->customer));
+        t->customer[sizeof(t->customer) - 1] = '\0';
+        t->customerPos = r->customerPos;
+        t->pay = r->pay;
+        t->maxPay = r->maxPay;
+        t->distance = r->distance;
+        t->status = (JobStatus)r->status;
+        t->jobType = r->jobType;
+        t->fragility = r->fragility;
+        t->isHeavy = r->isHeavy != 0;
+        t->timeLimit = r->timeLimit;
+        t->creationTime = now - r->age;
+        t->refreshTimer = r->refreshTimer;
+        memcpy(t->description, r->description, sizeof(t->description));
+        t->description[sizeof(t->description) - 1] = '\0';
+    }
+
+    GameMap *map = saveService.map;
+    ClearEvents(map);
+    for (int i = 0; i < snap->eventCount; i++) {
+        const SaveEventRecord *r = &snap->events[i];
+        MapEvent *e = &map->events[i];
+        e->active = true;
+        e->type = (MapEventType)r->type;
+        e->position = r->position;
+        e->radius = r->radius;
+        e->timer = r->timer;
+        memcpy(e->label, r->label, sizeof(e->label));
+        e->label[sizeof(e->label) - 1] = '\0';
+    }
+
+    int vehicles = 0;
+    if (saveService.traffic) {
+        vehicles = RestoreTrafficState(saveService.traffic, map, snap->vehicles, snap->vehicleCount);
+    }
+    TraceLog(LOG_INFO, "SAVE: Restored %d jobs, %d events, %d vehicles.", snap->taskCount, snap->eventCount, vehicles);
+}
+
+/*
+ * Description: Registers the map and traffic that SaveGame records and LoadGame restores.
+ * Parameters:
+ * - map: Loaded GameMap, or NULL to go back to player-only saves (before unloading the map).
+ * - traffic: TrafficManager for that map (may be NULL).
+ * Returns: None.
+ */
+void BindSaveWorld(GameMap *map, TrafficManager *traffic) {
+    saveService.map = map;
+    saveService.traffic = map ? traffic : NULL;
+}
+
+/*
+ * Description: Reads only the saved vehicle model name (for the menu preview).
+ * Parameters:
+ * - out: Destination buffer.
+ * - outSize: Size of out.
+ * Returns: True if a save exists and names a model.
+ */
+bool ReadSavedModelName(char *out, int outSize) {
+    FILE *file = fopen(SAVE_FILE_NAME, "rb");
+    if (!file) return false;
+
+    SaveSnapshot *snap = &saveService.loading;
+    memset(&snap->player, 0, sizeof(snap->player));
+    bool read = ReadSaveFile(file, snap, NULL);
+    fclose(file);
+
+    snap->player.modelFileName[sizeof(snap->player.modelFileName) - 1] = '\0';
+    if (!read || snap->player.modelFileName[0] == '\0') return false;
+    snprintf(out, outSize, "%s", snap->player.modelFileName);
+    return true;
+}
+
+/*
+ * Description: Streams the save file back in and restores the player, phone settings and, when the
+ *              save was made on the bound map, the delivery jobs, map events and traffic.
  * Parameters:
  * - player: Pointer to the Player struct to populate.
  * - phone: Pointer to PhoneState to populate.
- * Returns: True if load was successful, false if file missing or version mismatch.
+ * Returns: True if load was successful, false if file missing or unreadable.
  */
 bool LoadGame(Player *player, PhoneState *phone) {
+    FlushSaves();
+
     FILE *file = fopen(SAVE_FILE_NAME, "rb");
     if (!file) {
         TraceLog(LOG_INFO, "SAVE: No save file found. Starting fresh.");
         return false;
     }
 
-    GameSaveData data;
-    size_t read = fread(&data, sizeof(GameSaveData), 1, file);
+    // 1. READ (fields missing from an older file keep the current values)
+    SaveSnapshot *snap = &saveService.loading;
+    PackSaveData(player, phone, &snap->player);
+    bool read = ReadSaveFile(file, snap, saveService.map);
     fclose(file);
 
-    if (read != 1) return false;
-
-    // 1. DECRYPT
-    Obfuscate((unsigned char*)&data, sizeof(GameSaveData));
+    if (!read) return false;
+    GameSaveData data = snap->player;
 
-    // 2. VERSION CHECK
-    if (data.version != SAVE_VERSION) {
-        TraceLog(LOG_WARNING, "SAVE: Save version mismatch (Old file?). Starting fresh.");
-        return false;
-    }
+    // 2. WORLD STATE (jobs, events, traffic) when the save was made on this map
+    if (snap->hasWorld) ApplyWorldState(phone, snap);
 
     // 3. UNPACK DATA
     
     // Position
     player->position = data.position;
     player->angle = data.angle;
+    SnapPlayerState(player);
     
     // Garage Restoration
     for(int i = 0; i < 10; i++) {
@@ -166,7 +709,7 @@ bool LoadGame(Player *player, PhoneState *phone) {
         
         char path[128];
         sprintf(path, "resources/Playermodels/%s", data.modelFileName);
-        player->model = LoadModel(path);
+        player->model = LoadModelCached(path);
         
         strcpy(player->currentModelFileName, data.modelFileName);
         
@@ -221,7 +764,9 @@ bool LoadGame(Player *player, PhoneState *phone) {
  * Returns: None.
  */
 void ResetSaveGame(Player *player, PhoneState *phone) {
-    // 1. DELETE FILE
+    // 1. DELETE FILE (after any queued write lands, or it would bring the file back)
+    FlushSaves();
+    saveService.timeSinceSave = 0.0f;
     if (FileExists(SAVE_FILE_NAME)) {
         remove(SAVE_FILE_NAME);
     }
@@ -236,6 +781,7 @@ void ResetSaveGame(Player *player, PhoneState *phone) {
     player->position = (Vector3){ 0.0f, 1.0f, 0.0f }; 
     player->angle = 0.0f;
     player->current_speed = 0.0f;
+    SnapPlayerState(player);
     player->health = 100.0f;
     
     player->money = 50.0f;
@@ -257,7 +803,7 @@ void ResetSaveGame(Player *player, PhoneState *phone) {
     
     char path[128] = "resources/Playermodels/sedan.obj";
     if (FileExists(path)) {
-        player->model = LoadModel(path);
+        player->model = LoadModelCached(path);
         strcpy(player->currentModelFileName, "sedan.obj");
     }
     
@@ -296,6 +842,7 @@ void ResetSaveGame(Player *player, PhoneState *phone) {
     phone->settings.sfxVolume = 1.0f;
     phone->settings.mute = false;
 
+    StopMusic();
     phone->music.isPlaying = false;
     phone->music.currentSongIdx = 0;
 
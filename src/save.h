@@ -21,10 +21,12 @@
 #include "phone.h" // [FIX] This needs to be included to see PhoneSettings
 
 #define SAVE_FILE_NAME "save_data.dat"
-#define SAVE_VERSION 2  
+#define SAVE_VERSION 2  // GameSaveData layout; also the whole file before the chunked format
 
 typedef struct PhoneState PhoneState;
 
+// Player record, stored as the PLYR chunk (see save.c). Append new fields at the end only:
+// loaders read min(stored, compiled) bytes and keep current values for the rest.
 typedef struct GameSaveData {
     int version;
     
@@ -81,5 +83,9 @@ typedef struct GameSaveData {
 bool SaveGame(Player *player, PhoneState *phone);
 bool LoadGame(Player *player, PhoneState *phone);
 void ResetSaveGame(Player *player, PhoneState *phone);
+void UpdateSaveService(Player *player, PhoneState *phone, float dt, bool allowAutosave);
+void FlushSaves(void);
+void BindSaveWorld(GameMap *map, TrafficManager *traffic);
+bool ReadSavedModelName(char *out, int outSize);
 
 #endif
\ No newline at end of file
@@ -372,7 +372,7 @@ void DrawThermometer(DeliveryTask *task, float x, float y, float scale) {
     DrawRectangleLines(x, y, w, h, WHITE);
     
     if (task && task->timeLimit > 0) {
-        double elapsed = GetTime() - task->creationTime;
+        double elapsed = GetDeliveryClock() - task->creationTime;
         float tempPct = 1.0f - ((float)elapsed / task->timeLimit);
         
         if (tempPct < 0.0f) tempPct = 0.0f;
@@ -580,7 +580,7 @@ void DrawCargoHUD(PhoneState *phone, Player *player) {
     DrawRectangleRoundedLines(panel, 0.2f, 4, DARKGRAY);
 
     // 3. Common Data Calculation
-    double timeElapsed = GetTime() - activeTask->creationTime;
+    double timeElapsed = GetDeliveryClock() - activeTask->creationTime;
     float contentX = panel.x + 15;
     float currentY = panel.y + 10; 
 
@@ -18,6 +18,7 @@
 #include "raylib.h"
 #include "rlgl.h"
 #include "raymath.h"
+#include "asset_cache.h"
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -26,6 +27,7 @@
 // --- CONFIG ---
 #define MAX_BG_BUILDINGS 1500 
 #define MAX_BG_WINDOWS 5000 
+#define MENU_LOAD_SHARE 0.9f  // Bar share of the background map load; the warmup frames fill the rest
 
 // --- COLORS ---
 #define COLOR_SKY       (Color){ 10, 10, 15, 255 }   
@@ -56,6 +58,14 @@ typedef struct {
 
 static MenuAssets menuAssets = {0};
 
+#define MENU_MODEL_COUNT 3
+static const char *menuModelPaths[MENU_MODEL_COUNT] = {
+    "resources/Props/light-curved.obj",
+    "resources/trees/tree-small.obj",
+    "resources/random/trash.obj"
+};
+static bool menuModelFallback[MENU_MODEL_COUNT] = { false };
+
 // Static variables to persist the car model
 static Model menuCarModel = { 0 };
 static bool isMenuCarLoaded = false;
@@ -92,19 +102,46 @@ void SaveMapChoice(int choice) {
     }
 }
 
-const unsigned char MENU_KEY = 0xAA; 
-
 /*
- * Description: XOR obfuscation for simple data encryption/decryption in the menu.
- * Parameters:
- * - data: Pointer to data buffer.
- * - size: Size of buffer.
- * Returns: None.
+ * Description: Resolves the map file from the saved map choice (defaults to the small city).
+ * Parameters: None.
+ * Returns: Path to the .map file.
  */
-void MenuObfuscate(unsigned char* data, size_t size) {
-    for (size_t i = 0; i < size; i++) {
-        data[i] ^= MENU_KEY;
+static const char *ResolveMapPath(void) {
+    const char *mapPath = "resources/maps/real_city.map"; // Default
+
+    if (FileExists(CONFIG_FILE)) {
+        FILE *f = fopen(CONFIG_FILE, "rb");
+        if (f) {
+            int choice = 1;
+            fread(&choice, sizeof(int), 1, f);
+            fclose(f);
+            
+            if (choice == 2) {
+                mapPath = "resources/maps/smaller_city.map"; // Big City
+                printf("MAIN: Loading Big City based on user choice.\n");
+            } else {
+                printf("MAIN: Loading Small City based on user choice.\n");
+            }
+        }
+    } else {
+        // If no config found, default to Small City
+        printf("MAIN: No config found, defaulting to Small City.\n");
     }
+    return mapPath;
+}
+
+// Map the current background load was started with
+static const char *chosenMapPath = NULL;
+
+/*
+ * Description: Returns the map file the menu started loading.
+ * Parameters: None.
+ * Returns: Path to the .map file.
+ */
+const char *GetChosenMapPath(void) {
+    if (!chosenMapPath) chosenMapPath = ResolveMapPath();
+    return chosenMapPath;
 }
 
 // 0 = Continue, 1 = New Game
@@ -245,14 +282,16 @@ void LoadMenuAssets(void) {
         UnloadImage(whiteImg);
     }
 
-    #define LOAD_MODEL(target, path) \
-        target = LoadModel(path); \
-        if (target.meshCount == 0) target = LoadModelFromMesh(GenMeshCube(1,1,1)); \
-        target.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = menuAssets.atlas;
+    // Diorama props come from the asset registry (released again when the game starts)
+    Model *modelTargets[] = { &menuAssets.light, &menuAssets.tree, &menuAssets.trash };
+    Model loaded[MENU_MODEL_COUNT];
+    AcquireModels(menuModelPaths, loaded, MENU_MODEL_COUNT);
 
-    LOAD_MODEL(menuAssets.light, "resources/Props/light-curved.obj");
-    LOAD_MODEL(menuAssets.tree, "resources/trees/tree-small.obj");
-    LOAD_MODEL(menuAssets.trash, "resources/random/trash.obj");
+    for (int i = 0; i < MENU_MODEL_COUNT; i++) {
+        menuModelFallback[i] = (loaded[i].meshCount == 0);
+        *modelTargets[i] = menuModelFallback[i] ? LoadModelFromMesh(GenMeshCube(1,1,1)) : loaded[i];
+        modelTargets[i]->materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = menuAssets.atlas;
+    }
 
     // Allocate Data
     menuAssets.bPos = (Vector3*)RL_MALLOC(MAX_BG_BUILDINGS * sizeof(Vector3));
@@ -361,9 +400,11 @@ void UnloadMenuAssets(void) {
     if (menuAssets.trash.materialCount > 0) menuAssets.trash.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = nullTex;
 
     UnloadTexture(menuAssets.atlas);
-    UnloadModel(menuAssets.light);
-    UnloadModel(menuAssets.tree);
-    UnloadModel(menuAssets.trash);
+    Model menuModels[MENU_MODEL_COUNT] = { menuAssets.light, menuAssets.tree, menuAssets.trash };
+    for (int i = 0; i < MENU_MODEL_COUNT; i++) {
+        if (menuModelFallback[i]) UnloadModel(menuModels[i]);
+    }
+    ReleaseModels(menuModelPaths, MENU_MODEL_COUNT);
     
     RL_FREE(menuAssets.bPos);
     RL_FREE(menuAssets.bSize);
@@ -384,31 +425,20 @@ void DrawMenuPlayerCar(void) {
         char modelPath[256] = "resources/Playermodels/delivery.obj"; // Default Fallback
 
         // Try reading save file to find custom car
-        FILE *file = fopen("save_data.dat", "rb");
-        if (file) {
-            GameSaveData data;
-            size_t read = fread(&data, sizeof(GameSaveData), 1, file);
-            fclose(file);
-            
-            if (read == 1) {
-                // Decrypt
-                MenuObfuscate((unsigned char*)&data, sizeof(GameSaveData));
-                
-                if (data.version == SAVE_VERSION && strlen(data.modelFileName) > 0) {
-                    snprintf(modelPath, 256, "resources/Playermodels/%s", data.modelFileName);
-                    printf("MENU: Found player vehicle in save: %s\n", modelPath);
-                }
-            }
+        char savedModel[64];
+        if (ReadSavedModelName(savedModel, sizeof(savedModel))) {
+            snprintf(modelPath, 256, "resources/Playermodels/%s", savedModel);
+            printf("MENU: Found player vehicle in save: %s\n", modelPath);
         }
 
         // Load the Model
         if (FileExists(modelPath)) {
-            menuCarModel = LoadModel(modelPath);
+            menuCarModel = LoadModelCached(modelPath);
             isMenuCarLoaded = true;
         } 
         else if (FileExists("resources/Playermodels/delivery.obj")) {
             // Ultimate fallback if saved mod file is missing
-            menuCarModel = LoadModel("resources/Playermodels/delivery.obj");
+            menuCarModel = LoadModelCached("resources/Playermodels/delivery.obj");
             isMenuCarLoaded = true;
         }
     }
@@ -609,14 +639,17 @@ bool RunStartMenu_PreLoad(int screenWidth, int screenHeight) {
     Vector3 camEndPos = { 0.0f, 2.5f, -5.0f }; 
     float zoomTimer = 0.0f;
 
+    // Indexed by MapLoadStage
     const char* preLoadMessages[] = {
         "Initializing Physics Engine...",
+        "Loading City Assets...",
         "Parsing City Graph Nodes...",
+        "Sorting City Sectors...",
         "Generating Traffic Network...",
         "Baking Static Geometry...",
-        "Optimizing Navigation Mesh...",
-        "Generating Map File..."
+        "Uploading City To GPU..."
     };
+    bool mapLoadStarted = false;
 
     while (!WindowShouldClose()) {
         float dt = GetFrameTime();
@@ -625,6 +658,9 @@ bool RunStartMenu_PreLoad(int screenWidth, int screenHeight) {
         int sh = GetScreenHeight();
         float uiScale = sh / 720.0f;
 
+        // Uploads whatever the loader thread has decoded (city assets)
+        if (mapLoadStarted) UpdateMapLoad();
+
         if (menuState == -1) {
             LoadMenuAssets();
             menuState = 0;
@@ -683,6 +719,13 @@ bool RunStartMenu_PreLoad(int screenWidth, int screenHeight) {
         
         // STATE 1: ZOOM ANIMATION
         else if (menuState == 1) { 
+            // The map loads on a background thread while the camera zooms in
+            if (!mapLoadStarted) {
+                chosenMapPath = ResolveMapPath();
+                StartMapLoad(chosenMapPath);
+                mapLoadStarted = true;
+            }
+
             zoomTimer += dt;
             float t = zoomTimer / 1.5f; 
             if (t >= 1.0f) { t = 1.0f; menuState = 2; }
@@ -691,26 +734,24 @@ bool RunStartMenu_PreLoad(int screenWidth, int screenHeight) {
             camera.position.y = camStartPos.y + (camEndPos.y - camStartPos.y) * st;
             camera.position.z = camStartPos.z + (camEndPos.z - camStartPos.z) * st;
         }
-        // STATE 2: FAKE LOADING
+        // STATE 2: LOADING (real progress from the loader thread)
         else if (menuState == 2) { 
-            float speed = (sharedStage == 3) ? 0.3f : 0.9f; 
-            sharedProgress += speed * dt;
-            if (sharedProgress > 0.10f) sharedStage = 1;
-            if (sharedProgress > 0.20f) sharedStage = 2;
-            if (sharedProgress > 0.30f) sharedStage = 3;
-            if (sharedProgress > 0.45f) sharedStage = 4;
+            float target = MENU_LOAD_SHARE * GetMapLoadProgress();
+            sharedProgress += (target - sharedProgress) * fminf(1.0f, 6.0f * dt);
+            sharedStage = (int)GetMapLoadStage();
             
-            if (sharedProgress >= 0.50f) {
-                sharedProgress = 0.50f;
-                sharedStage = 5; 
+            if (IsMapLoadDone() && sharedProgress >= MENU_LOAD_SHARE - 0.01f) {
+                sharedProgress = MENU_LOAD_SHARE;
+                sharedStage = MAP_LOAD_READY; 
                 static int f = 0; f++;
                 if (f > 10) { 
+                    f = 0;
                     if (isMenuCarLoaded) {
                         UnloadModel(menuCarModel);
                         isMenuCarLoaded = false;
                     }
                     UnloadMenuAssets(); 
-                    return true; // Start Game
+                    return true; // Start Game (main.c calls FinishMapLoad)
                 }
             }
         }
@@ -845,38 +886,19 @@ bool RunStartMenu_PreLoad(int screenWidth, int screenHeight) {
 }
 
 /*
- * Description: Renders the second phase of loading (map generation) after the start menu closes.
+ * Description: Renders the last part of the loading bar (world warmup) after the start menu closes.
  * Parameters:
  * - screenWidth: Screen width.
  * - screenHeight: Screen height.
- * - dt: Delta Time.
+ * - progress: Warmup progress in [0, 1] (frames rendered / warmup frames).
  * Returns: True if loading is still in progress, false if finished.
  */
-bool DrawPostLoadOverlay(int screenWidth, int screenHeight, float dt) {
-    if (sharedProgress < 0.5f) sharedProgress = 0.5f;
-
-    const char* postLoadMessages[] = {
-        "Loading Map File...", 
-        "Generating Terrain Chunks...", 
-        "Populating City Sectors...", 
-        "Spawning AI Traffic...", 
-        "Igniting Engine...",
-        "Ready"
-    };
-
-    int msgIndex = 0;
-    if (sharedProgress > 0.6f) msgIndex = 1;
-    if (sharedProgress > 0.7f) msgIndex = 2;
-    if (sharedProgress > 0.8f) msgIndex = 3;
-    if (sharedProgress > 0.9f) msgIndex = 4;
-    if (sharedProgress >= 1.0f) msgIndex = 5;
-
-    sharedProgress += 0.06f * dt; 
+bool DrawPostLoadOverlay(int screenWidth, int screenHeight, float progress) {
+    if (progress > 1.0f) progress = 1.0f;
+    sharedProgress = MENU_LOAD_SHARE + (1.0f - MENU_LOAD_SHARE) * progress;
 
-    DrawLoadingInterface(screenWidth, screenHeight, sharedProgress, postLoadMessages[msgIndex]);
+    const char *message = (progress >= 1.0f) ? "Ready" : "Warming Up Renderer...";
+    DrawLoadingInterface(screenWidth, screenHeight, sharedProgress, message);
 
-    if (sharedProgress >= 1.0f) {
-        return false; 
-    }
-    return true; 
-}
\ No newline at end of file
+    return progress < 1.0f;
+}
@@ -22,13 +22,18 @@
 
 void DrawLoadingInterface(int screenWidth, int screenHeight, float progress, const char* status);
 
-// Returns true if the user pressed start and we reached 50% (Time to load map)
+// Starts the background map load (StartMapLoad) once the player picks a game and
+// services it (UpdateMapLoad) every frame.
+// Returns true when the loader thread is done (main.c calls FinishMapLoad)
 // Returns false if the user closed the window
 bool RunStartMenu_PreLoad(int screenWidth, int screenHeight);
 
-// Call this at the END of your main game drawing loop.
+// Map file the menu started loading
+const char *GetChosenMapPath(void);
+
+// Call this at the END of your main game drawing loop with the warmup progress (0..1).
 // Returns TRUE if the loading screen is still active (keep drawing).
 // Returns FALSE when it hits 100% and should stop being called.
-bool DrawPostLoadOverlay(int screenWidth, int screenHeight, float dt);
+bool DrawPostLoadOverlay(int screenWidth, int screenHeight, float progress);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,473 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+// fileno/fsync/nanosleep need POSIX visibility under strict -std=c17
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "thread_pool.h"
+#include "profiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// NOTE: This file must not include raylib.h, windows.h clashes with it
+// (CloseWindow, DrawText, ...). Keep all platform code in here.
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #include <process.h>
+    #include <io.h>
+    typedef HANDLE PoolThread;
+    typedef CRITICAL_SECTION PoolMutex;
+    typedef CONDITION_VARIABLE PoolCond;
+    #define POOL_MUTEX_INIT(m)      InitializeCriticalSection(m)
+    #define POOL_MUTEX_DESTROY(m)   DeleteCriticalSection(m)
+    #define POOL_LOCK(m)            EnterCriticalSection(m)
+    #define POOL_UNLOCK(m)          LeaveCriticalSection(m)
+    #define POOL_COND_INIT(c)       InitializeConditionVariable(c)
+    #define POOL_COND_DESTROY(c)    ((void)0)
+    #define POOL_WAIT(c, m)         SleepConditionVariableCS(c, m, INFINITE)
+    #define POOL_BROADCAST(c)       WakeAllConditionVariable(c)
+    #define POOL_SIGNAL(c)          WakeConditionVariable(c)
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+    #include <time.h>
+    typedef pthread_t PoolThread;
+    typedef pthread_mutex_t PoolMutex;
+    typedef pthread_cond_t PoolCond;
+    #define POOL_MUTEX_INIT(m)      pthread_mutex_init(m, NULL)
+    #define POOL_MUTEX_DESTROY(m)   pthread_mutex_destroy(m)
+    #define POOL_LOCK(m)            pthread_mutex_lock(m)
+    #define POOL_UNLOCK(m)          pthread_mutex_unlock(m)
+    #define POOL_COND_INIT(c)       pthread_cond_init(c, NULL)
+    #define POOL_COND_DESTROY(c)    pthread_cond_destroy(c)
+    #define POOL_WAIT(c, m)         pthread_cond_wait(c, m)
+    #define POOL_BROADCAST(c)       pthread_cond_broadcast(c)
+    #define POOL_SIGNAL(c)          pthread_cond_signal(c)
+#endif
+
+// --- POOL STATE ---
+typedef struct {
+    bool running;
+    int workerCount;
+    PoolThread threads[MAX_POOL_WORKERS];
+    int workerIds[MAX_POOL_WORKERS];
+
+    PoolMutex lock;
+    PoolCond wake;      // Main -> Workers: new job posted
+    PoolCond done;      // Workers -> Main: last slice finished
+
+    // Current job (guarded by lock)
+    unsigned int generation;
+    int pending;
+    ParallelTaskFn fn;
+    void *context;
+    int count;
+} ThreadPool;
+
+static ThreadPool pool = {0};
+
+struct BackgroundJob {
+    BackgroundTaskFn fn;
+    void *context;
+    bool threaded;      // false when the job ran inline
+    bool done;          // Guarded by lock
+    PoolThread thread;
+    PoolMutex lock;
+};
+
+/*
+ * Description: Returns the bounds of one thread's slice of a ParallelFor range.
+ * Parameters:
+ * - count: Total number of items.
+ * - slice: Slice index (0..slices-1).
+ * - slices: Number of slices.
+ * - start/end: Output range [start, end).
+ * Returns: None.
+ */
+static void GetSliceRange(int count, int slice, int slices, int *start, int *end) {
+    *start = (int)(((long long)count * slice) / slices);
+    *end = (int)(((long long)count * (slice + 1)) / slices);
+}
+
+/*
+ * Description: Worker thread loop. Sleeps until a new job generation is posted, runs its slice, reports back.
+ * Parameters:
+ * - workerId: The worker's slice index.
+ * Returns: None.
+ */
+static void WorkerLoop(int workerId) {
+    unsigned int seenGeneration = 0;
+
+    char threadName[PROFILER_THREAD_NAME_LEN];
+    snprintf(threadName, sizeof(threadName), "Worker %d", workerId + 1);
+    PROFILE_THREAD_NAME(threadName);
+
+    POOL_LOCK(&pool.lock);
+    while (true) {
+        while (pool.running && pool.generation == seenGeneration) {
+            POOL_WAIT(&pool.wake, &pool.lock);
+        }
+        if (!pool.running) break;
+
+        seenGeneration = pool.generation;
+        ParallelTaskFn fn = pool.fn;
+        void *context = pool.context;
+        int start, end;
+        GetSliceRange(pool.count, workerId, pool.workerCount + 1, &start, &end);
+        POOL_UNLOCK(&pool.lock);
+
+        if (end > start) fn(context, start, end);
+
+        POOL_LOCK(&pool.lock);
+        pool.pending--;
+        if (pool.pending == 0) POOL_SIGNAL(&pool.done);
+    }
+    POOL_UNLOCK(&pool.lock);
+    ProfilerReleaseThread();
+}
+
+#if defined(_WIN32)
+static unsigned __stdcall WorkerEntry(void *arg) { WorkerLoop(*(int *)arg); return 0; }
+#else
+static void *WorkerEntry(void *arg) { WorkerLoop(*(int *)arg); return NULL; }
+#endif
+
+/*
+ * Description: Queries the number of logical CPU cores.
+ * Parameters: None.
+ * Returns: Core count (at least 1).
+ */
+static int GetCoreCount(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int cores = (int)info.dwNumberOfProcessors;
+#else
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (cores < 1) ? 1 : cores;
+}
+
+/*
+ * Description: Creates the worker threads. Safe to call more than once.
+ * Parameters:
+ * - workerCount: Number of workers, or <= 0 to use (cores - 1).
+ * Returns: None.
+ */
+void InitThreadPool(int workerCount) {
+    if (pool.running) return;
+    PROFILE_THREAD_NAME("Main"); // The pool is owned by the main thread
+
+    if (workerCount <= 0) workerCount = GetCoreCount() - 1;
+    if (workerCount > MAX_POOL_WORKERS) workerCount = MAX_POOL_WORKERS;
+    if (workerCount <= 0) return; // Single core: everything runs inline
+
+    POOL_MUTEX_INIT(&pool.lock);
+    POOL_COND_INIT(&pool.wake);
+    POOL_COND_INIT(&pool.done);
+    pool.generation = 0;
+    pool.pending = 0;
+    pool.running = true;
+    pool.workerCount = 0;
+
+    for (int i = 0; i < workerCount; i++) {
+        pool.workerIds[i] = i;
+#if defined(_WIN32)
+        uintptr_t handle = _beginthreadex(NULL, 0, WorkerEntry, &pool.workerIds[i], 0, NULL);
+        if (handle == 0) break;
+        pool.threads[i] = (HANDLE)handle;
+#else
+        if (pthread_create(&pool.threads[i], NULL, WorkerEntry, &pool.workerIds[i]) != 0) break;
+#endif
+        pool.workerCount++;
+    }
+
+    printf("THREADS: Started %d worker threads.\n", pool.workerCount);
+}
+
+/*
+ * Description: Stops and joins all worker threads.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ShutdownThreadPool(void) {
+    if (!pool.running) return;
+
+    POOL_LOCK(&pool.lock);
+    pool.running = false;
+    POOL_BROADCAST(&pool.wake);
+    POOL_UNLOCK(&pool.lock);
+
+    for (int i = 0; i < pool.workerCount; i++) {
+#if defined(_WIN32)
+        WaitForSingleObject(pool.threads[i], INFINITE);
+        CloseHandle(pool.threads[i]);
+#else
+        pthread_join(pool.threads[i], NULL);
+#endif
+    }
+
+    POOL_COND_DESTROY(&pool.wake);
+    POOL_COND_DESTROY(&pool.done);
+    POOL_MUTEX_DESTROY(&pool.lock);
+    pool.workerCount = 0;
+}
+
+/*
+ * Description: Returns how many worker threads are running (0 when everything runs inline).
+ * Parameters: None.
+ * Returns: Worker count.
+ */
+int GetThreadPoolWorkerCount(void) {
+    return pool.running ? pool.workerCount : 0;
+}
+
+/*
+ * Description: Runs fn over [0, count) split into contiguous slices across the pool and the calling thread.
+ * Parameters:
+ * - count: Number of items.
+ * - minBatch: Minimum items per slice before it is worth waking the workers.
+ * - fn: Work callback.
+ * - context: User pointer passed to fn.
+ * Returns: None.
+ */
+void ParallelFor(int count, int minBatch, ParallelTaskFn fn, void *context) {
+    if (count <= 0) return;
+
+    int slices = GetThreadPoolWorkerCount() + 1;
+    if (slices == 1 || count < minBatch * slices) {
+        fn(context, 0, count);
+        return;
+    }
+
+    POOL_LOCK(&pool.lock);
+    pool.fn = fn;
+    pool.context = context;
+    pool.count = count;
+    pool.pending = pool.workerCount;
+    pool.generation++;
+    POOL_BROADCAST(&pool.wake);
+    POOL_UNLOCK(&pool.lock);
+
+    // The caller takes the last slice
+    int start, end;
+    GetSliceRange(count, slices - 1, slices, &start, &end);
+    if (end > start) fn(context, start, end);
+
+    POOL_LOCK(&pool.lock);
+    while (pool.pending > 0) POOL_WAIT(&pool.done, &pool.lock);
+    POOL_UNLOCK(&pool.lock);
+}
+
+// --- BACKGROUND JOBS ---
+
+#if defined(_WIN32)
+static unsigned __stdcall BackgroundEntry(void *arg)
+#else
+static void *BackgroundEntry(void *arg)
+#endif
+{
+    BackgroundJob *job = (BackgroundJob *)arg;
+    job->fn(job->context);
+    ProfilerReleaseThread(); // Background threads come and go, free the trace slot for the next one
+
+    POOL_LOCK(&job->lock);
+    job->done = true;
+    POOL_UNLOCK(&job->lock);
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+/*
+ * Description: Creates a job and tries to give it its own thread.
+ * Parameters:
+ * - fn: Job function.
+ * - context: User pointer passed to fn.
+ * - allowInline: Run fn on the caller if no thread could be created.
+ * Returns: Job handle, NULL if out of memory or (without allowInline) no thread was available.
+ */
+static BackgroundJob *CreateBackgroundJob(BackgroundTaskFn fn, void *context, bool allowInline) {
+    BackgroundJob *job = (BackgroundJob *)calloc(1, sizeof(BackgroundJob));
+    if (!job) return NULL;
+
+    job->fn = fn;
+    job->context = context;
+    POOL_MUTEX_INIT(&job->lock);
+
+#if defined(_WIN32)
+    uintptr_t handle = _beginthreadex(NULL, 0, BackgroundEntry, job, 0, NULL);
+    job->threaded = (handle != 0);
+    if (job->threaded) job->thread = (HANDLE)handle;
+#else
+    job->threaded = (pthread_create(&job->thread, NULL, BackgroundEntry, job) == 0);
+#endif
+
+    if (!job->threaded) {
+        if (!allowInline) {
+            POOL_MUTEX_DESTROY(&job->lock);
+            free(job);
+            return NULL;
+        }
+        // No thread available: do the work now
+        fn(context);
+        job->done = true;
+    }
+    return job;
+}
+
+/*
+ * Description: Runs fn(context) on a dedicated thread without blocking the caller.
+ * Parameters:
+ * - fn: Job function.
+ * - context: User pointer passed to fn.
+ * Returns: Job handle for IsBackgroundJobDone/FinishBackgroundJob, NULL if out of memory.
+ */
+BackgroundJob *StartBackgroundJob(BackgroundTaskFn fn, void *context) {
+    return CreateBackgroundJob(fn, context, true);
+}
+
+/*
+ * Description: Like StartBackgroundJob, but never runs fn inline. For loops that only return
+ * when asked to (audio worker), where an inline run would never give control back.
+ * Parameters:
+ * - fn: Thread function.
+ * - context: User pointer passed to fn.
+ * Returns: Job handle, NULL if no thread could be created.
+ */
+BackgroundJob *StartBackgroundThread(BackgroundTaskFn fn, void *context) {
+    return CreateBackgroundJob(fn, context, false);
+}
+
+/*
+ * Description: Checks whether a background job has finished, without blocking.
+ * Parameters:
+ * - job: Job handle (NULL counts as done).
+ * Returns: True if the job function has returned.
+ */
+bool IsBackgroundJobDone(BackgroundJob *job) {
+    if (!job) return true;
+
+    POOL_LOCK(&job->lock);
+    bool done = job->done;
+    POOL_UNLOCK(&job->lock);
+    return done;
+}
+
+/*
+ * Description: Waits for a background job, joins its thread and frees the handle.
+ * Parameters:
+ * - job: Job handle (NULL is ignored).
+ * Returns: None.
+ */
+void FinishBackgroundJob(BackgroundJob *job) {
+    if (!job) return;
+
+    if (job->threaded) {
+#if defined(_WIN32)
+        WaitForSingleObject(job->thread, INFINITE);
+        CloseHandle(job->thread);
+#else
+        pthread_join(job->thread, NULL);
+#endif
+    }
+    POOL_MUTEX_DESTROY(&job->lock);
+    free(job);
+}
+
+// --- SHARED LOCKS ---
+
+struct SharedLock {
+    PoolMutex mutex;
+};
+
+/*
+ * Description: Creates a mutex for state shared between the main thread and a background thread.
+ * Parameters: None.
+ * Returns: Lock handle, NULL if out of memory.
+ */
+SharedLock *CreateSharedLock(void) {
+    SharedLock *lock = (SharedLock *)malloc(sizeof(SharedLock));
+    if (lock) POOL_MUTEX_INIT(&lock->mutex);
+    return lock;
+}
+
+void DestroySharedLock(SharedLock *lock) {
+    if (!lock) return;
+    POOL_MUTEX_DESTROY(&lock->mutex);
+    free(lock);
+}
+
+void LockShared(SharedLock *lock) {
+    POOL_LOCK(&lock->mutex);
+}
+
+void UnlockShared(SharedLock *lock) {
+    POOL_UNLOCK(&lock->mutex);
+}
+
+/*
+ * Description: Suspends the calling thread (does not spin).
+ * Parameters:
+ * - ms: Milliseconds to sleep.
+ * Returns: None.
+ */
+void SleepMilliseconds(int ms) {
+    if (ms <= 0) return;
+#if defined(_WIN32)
+    Sleep((DWORD)ms);
+#else
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+// --- PLATFORM FILE HELPERS ---
+
+/*
+ * Description: Flushes a file's data through the C runtime and the OS cache to disk.
+ * Parameters:
+ * - file: Open file, written with stdio.
+ * Returns: True on success.
+ */
+bool SyncFileToDisk(FILE *file) {
+    if (fflush(file) != 0) return false;
+#if defined(_WIN32)
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+/*
+ * Description: Atomically replaces path with tempPath (readers see the old or the new file, never a mix).
+ * Parameters:
+ * - tempPath: Fully written file to move into place.
+ * - path: Destination, replaced if it exists.
+ * Returns: True on success.
+ */
+bool ReplaceFileAtomic(const char *tempPath, const char *path) {
+#if defined(_WIN32)
+    return MoveFileExA(tempPath, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return rename(tempPath, path) == 0;
+#endif
+}
@@ -0,0 +1,81 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#define MAX_POOL_WORKERS 7
+
+// Work callback: processes items [start, end) of a ParallelFor range
+typedef void (*ParallelTaskFn)(void *context, int start, int end);
+
+// Spawns the worker threads. workerCount <= 0 picks (CPU cores - 1).
+void InitThreadPool(int workerCount);
+
+// Joins and releases all worker threads
+void ShutdownThreadPool(void);
+
+int GetThreadPoolWorkerCount(void);
+
+// Splits [0, count) into one contiguous slice per thread (workers + caller)
+// and blocks until every slice is done. Runs inline when the pool is not
+// running or the range is smaller than minBatch per thread.
+// Must only be called from the main thread.
+void ParallelFor(int count, int minBatch, ParallelTaskFn fn, void *context);
+
+// --- Background jobs ---
+// A single function run on its own thread while the main loop keeps going
+// (asset prefetch, streaming). Jobs must not call ParallelFor.
+typedef void (*BackgroundTaskFn)(void *context);
+typedef struct BackgroundJob BackgroundJob;
+
+// Starts fn(context) on a new thread. Runs it inline if the thread cannot be
+// created, so the returned job is always valid (NULL only if out of memory).
+BackgroundJob *StartBackgroundJob(BackgroundTaskFn fn, void *context);
+
+// Like StartBackgroundJob but never runs fn inline: returns NULL when no thread
+// could be created. For loops that run until told to stop (audio worker).
+BackgroundJob *StartBackgroundThread(BackgroundTaskFn fn, void *context);
+
+// Non-blocking completion check
+bool IsBackgroundJobDone(BackgroundJob *job);
+
+// Blocks until the job has finished, joins its thread and frees the handle
+void FinishBackgroundJob(BackgroundJob *job);
+
+// --- Shared locks (state touched by a background thread and the main thread) ---
+typedef struct SharedLock SharedLock;
+
+SharedLock *CreateSharedLock(void);
+void DestroySharedLock(SharedLock *lock);
+void LockShared(SharedLock *lock);
+void UnlockShared(SharedLock *lock);
+
+// Sleeps the calling thread (no busy wait, unlike raylib's WaitTime)
+void SleepMilliseconds(int ms);
+
+// --- Platform file helpers (live here with the rest of the platform code) ---
+
+// fflush + fsync/_commit
+bool SyncFileToDisk(FILE *file);
+
+// rename() that replaces an existing destination atomically on every platform
+bool ReplaceFileAtomic(const char *tempPath, const char *path);
+
+#endif
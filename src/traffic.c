@@ -21,6 +21,10 @@
 #include <stdlib.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
+#include "thread_pool.h"
+#include "perf_overlay.h"
+#include "profiler.h"
 
 // --- CONFIGURATION ---
 #define SPAWN_RADIUS_MIN 100.0f   
@@ -35,10 +39,70 @@
 #define BRAKE_RATE 12.0f       
 #define STUCK_THRESHOLD 5.0f 
 
-extern int GetClosestNode(GameMap *map, Vector2 position);
+// --- INTERSECTIONS ---
+#define SIGNAL_LOOKAHEAD 25.0f     // Same window as the turn slow-down
+#define STOP_LINE_OFFSET 3.0f      // Stop this far before the node, outside the junction
+#define YELLOW_COMMIT_DIST 8.0f    // Closer than this to the line on yellow: keep going
+
+// --- LEVEL OF DETAIL ---
+// Cars near the player get the full per-frame (micro) update. Everything further out
+// only moves as an edge-level queue at a low tick rate (meso) and is never drawn.
+#define MICRO_RADIUS 120.0f       // Promote to micro inside this (render distance is ~100m)
+#define MESO_RADIUS 140.0f        // Demote to meso outside this (hysteresis band)
+#define MESO_TICK_INTERVAL 0.25f  // Seconds between meso updates
+#define MESO_SPACING 6.0f         // Bumper-to-bumper gap kept inside an edge queue
+#define SPAWN_INTERVAL 0.25f
+
+// --- SPAWNING ---
+#define SPAWN_BUDGET 2          // Max new cars per spawn tick
+#define SPAWN_ATTEMPTS 8        // Max candidate nodes tried per spawn tick
+#define MAX_RING_NODES 2048     // Candidate buffer for the spawn ring
+
+// --- THREADING ---
+#define TRAFFIC_MIN_BATCH 16  // Below this many cars per thread the update runs inline
+
+// --- RENDERING ---
+#define TRAFFIC_TYPE_COUNT 3          // Sedan, Van, Long Truck (type = index % 3)
+#define BRAKE_LIGHT_SPEED 3.0f
+#define VEHICLE_MODEL_YAW_FIX -10.0f  // Rotate the "Model" 10 degrees clockwise for alignment fix
+
+// Vertex color tag read by traffic.vs to pick each part's color
+enum {
+    TRAFFIC_PART_BODY = 0,
+    TRAFFIC_PART_CABIN,
+    TRAFFIC_PART_GLASS,
+    TRAFFIC_PART_BRAKE,
+    TRAFFIC_PART_HEADLIGHT
+};
+
+typedef struct TrafficInstance {
+    float transform[16];  // Column-major model matrix
+    float color[4];       // Paint RGB, alpha = brake lights on
+} TrafficInstance;
+
+typedef struct TrafficRenderer {
+    bool loaded;
+    bool instanced;       // False = GL/shader unavailable, immediate-mode fallback
+    Shader shader;
+    int locMvp;
+    Mesh meshes[TRAFFIC_TYPE_COUNT];
+    unsigned int instanceVbo[TRAFFIC_TYPE_COUNT];
+    TrafficInstance instances[TRAFFIC_TYPE_COUNT][MAX_VEHICLES];
+} TrafficRenderer;
+
+static TrafficRenderer trafficRenderer = {0};
+
+typedef struct TrafficStepContext {
+    TrafficManager *traffic;
+    GameMap *map;
+    Vector3 playerPos;
+    float dt;
+} TrafficStepContext;
+
 
 /*
- * Description: Initializes the traffic manager, deactivating all vehicle slots.
+ * Description: Initializes the traffic manager: deactivates all vehicle slots and rewinds the
+ * spawn/meso timers and the signal clock, so a fresh session always starts from the same state.
  * Parameters:
  * - traffic: Pointer to the TrafficManager struct.
  * Returns: None.
@@ -48,6 +112,19 @@ void InitTraffic(TrafficManager *traffic) {
         traffic->vehicles[i].active = false;
         traffic->vehicles[i].stuckTimer = 0.0f;
     }
+    traffic->spawnTimer = 0.0f;
+    traffic->mesoTimer = 0.0f;
+    ResetIntersections(&traffic->intersections);
+}
+
+/*
+ * Description: Releases memory owned by the traffic manager (intersection controller).
+ * Parameters:
+ * - traffic: Pointer to the TrafficManager struct.
+ * Returns: None.
+ */
+void UnloadTraffic(TrafficManager *traffic) {
+    UnloadIntersections(&traffic->intersections);
 }
 
 /*
@@ -91,35 +168,37 @@ int FindNextEdge(GameMap *map, int nodeID, int excludeEdgeIndex) {
 /*
  * Description: Checks for vehicles directly ahead on the same road segment to prevent collisions.
  * Parameters:
- * - traffic: Pointer to TrafficManager.
+ * - state: Vehicle state to scan (the read-only snapshot during the sense phase).
  * - myIndex: The vehicle's own index (to ignore self).
  * - myPos: Current position.
  * - myForward: Forward vector.
  * - myEdgeIndex: Current road edge index.
+ * - outIndex: Receives the index of the car ahead (-1 if clear).
  * Returns: Distance to the nearest car ahead, or -1.0f if clear.
  */
-float GetDistanceToCarAhead(TrafficManager *traffic, int myIndex, Vector3 myPos, Vector3 myForward, int myEdgeIndex) {
+float GetDistanceToCarAhead(const Vehicle *state, int myIndex, Vector3 myPos, Vector3 myForward, int myEdgeIndex, int *outIndex) {
     float closestDist = 9999.0f;
     bool found = false;
-    int myNextEdge = traffic->vehicles[myIndex].nextEdgeIndex;
+    *outIndex = -1;
+    int myNextEdge = state[myIndex].nextEdgeIndex;
 
     for (int i = 0; i < MAX_VEHICLES; i++) {
-        if (i == myIndex || !traffic->vehicles[i].active) continue;
+        if (i == myIndex || !state[i].active) continue;
         
-        int otherEdge = traffic->vehicles[i].currentEdgeIndex;
+        int otherEdge = state[i].currentEdgeIndex;
         if (otherEdge != myEdgeIndex && otherEdge != myNextEdge) continue; 
         
-        Vector3 otherPos = traffic->vehicles[i].position;
+        Vector3 otherPos = state[i].position;
         Vector3 toOther = Vector3Subtract(otherPos, myPos);
         
         if (Vector3DotProduct(toOther, myForward) < 0) continue; 
-        if (Vector3DotProduct(myForward, traffic->vehicles[i].forward) < -0.5f) continue;
+        if (Vector3DotProduct(myForward, state[i].forward) < -0.5f) continue;
 
         float distSq = Vector3LengthSqr(toOther);
         if (distSq > DETECTION_DIST * DETECTION_DIST) continue; 
 
         float dist = sqrtf(distSq);
-        if (dist < closestDist) { closestDist = dist; found = true; }
+        if (dist < closestDist) { closestDist = dist; found = true; *outIndex = i; }
     }
     return found ? closestDist : -1.0f;
 }
@@ -147,74 +226,65 @@ float GetDistanceToPlayer(Vector3 carPos, Vector3 carFwd, Vector3 playerPos) {
 }
 
 /*
- * Description: Updates logic for all traffic vehicles: spawning, movement, pathfinding, and obstacle avoidance.
+ * Description: Snaps a vehicle onto its lane from its current edge and progress.
  * Parameters:
- * - traffic: Pointer to TrafficManager.
- * - player_position: Player's position (for spawn/despawn logic).
+ * - v: Vehicle to align.
  * - map: Pointer to GameMap.
- * - dt: Delta Time.
  * Returns: None.
  */
-void UpdateTraffic(TrafficManager *traffic, Vector3 player_position, GameMap *map, float dt) {
-    if (map->edgeCount == 0 || map->nodeCount == 0 || !map->graph) return;
+static void AlignVehicleToLane(Vehicle *v, GameMap *map) {
+    Edge currentEdge = map->edges[v->currentEdgeIndex];
+    Vector2 s2d = map->nodes[v->startNodeID].position;
+    Vector2 e2d = map->nodes[v->endNodeID].position;
+    
+    Vector2 roadDir2D = Vector2Normalize(Vector2Subtract(e2d, s2d));
+    v->forward = (Vector3){ roadDir2D.x, 0, roadDir2D.y };
 
-    // --- 1. SPAWNING LOGIC ---
-    static float spawnTimer = 0.0f;
-    spawnTimer += dt;
-    if (spawnTimer > 0.5f) {
-        spawnTimer = 0.0f;
-        int slot = -1;
-        for (int i = 0; i < MAX_VEHICLES; i++) { if (!traffic->vehicles[i].active) { slot = i; break; } }
-
-        if (slot != -1) {
-            for (int attempt = 0; attempt < 20; attempt++) {
-                int randNodeID = GetRandomValue(0, map->nodeCount - 1);
-                Vector2 nodeWorld = map->nodes[randNodeID].position;
-                float dx = nodeWorld.x - player_position.x;
-                float dy = nodeWorld.y - player_position.z;
-                float distSq = dx*dx + dy*dy;
-
-                if (distSq > (SPAWN_RADIUS_MIN*SPAWN_RADIUS_MIN) && distSq < (SPAWN_RADIUS_MAX*SPAWN_RADIUS_MAX)) {
-                    int edgeIdx = FindNextEdge(map, randNodeID, -1);
-                    if (edgeIdx != -1) {
-                        Edge e = map->edges[edgeIdx];
-                        Vector2 n1 = map->nodes[e.startNode].position;
-                        Vector2 n2 = map->nodes[e.endNode].position;
-                        Vector3 testPos = { Lerp(n1.x, n2.x, 0.1f), ROAD_HEIGHT, Lerp(n1.y, n2.y, 0.1f) };
-                        if (TrafficCollision(traffic, testPos.x, testPos.z, 2.0f).z != -1) continue;
-
-                        Vehicle *v = &traffic->vehicles[slot];
-                        v->active = true;
-                        v->currentEdgeIndex = edgeIdx;
-                        v->speed = 0.0f; 
-                        v->stuckTimer = 0.0f;
-                        v->startNodeID = e.startNode;
-                        v->endNodeID = e.endNode;
-                        if (GetRandomValue(0,1)) { v->startNodeID = e.endNode; v->endNodeID = e.startNode; }
-                        v->nextEdgeIndex = FindNextEdge(map, v->endNodeID, v->currentEdgeIndex);
-                        v->progress = 0.1f;
-                        v->edgeLength = Vector2Distance(n1, n2);
-                        v->position = testPos;
-                        v->color = (Color){ GetRandomValue(80, 200), GetRandomValue(80, 200), GetRandomValue(80, 200), 255 };
-                        break; 
-                    }
-                }
-            }
-        }
-    }
+    Vector2 centerPos2D = Vector2Lerp(s2d, e2d, v->progress);
+    Vector2 rightVec2D = { -roadDir2D.y, roadDir2D.x };
+    
+    float offsetVal = currentEdge.oneway ? 0.0f : (currentEdge.width * 0.25f);
+    
+    v->position.x = centerPos2D.x + (rightVec2D.x * offsetVal);
+    v->position.z = centerPos2D.y + (rightVec2D.y * offsetVal);
+    v->position.y = ROAD_HEIGHT; 
+}
 
-    // --- 2. UPDATE INDIVIDUAL VEHICLES ---
-    for (int i = 0; i < MAX_VEHICLES; i++) {
-        Vehicle *v = &traffic->vehicles[i];
-        if (!v->active) continue;
+/*
+ * Description: Checks whether the signal or stop sign at the end of a vehicle's edge holds it at the stop line.
+ * Parameters:
+ * - traffic: Pointer to TrafficManager (signal state).
+ * - map: Pointer to GameMap.
+ * - v: Vehicle to check.
+ * - toStopLine: Distance from the vehicle to the stop line.
+ * Returns: True if the vehicle has to stop before the line. Already past the line means already
+ *          in the junction, which never stops.
+ */
+static bool MustStopAtNode(TrafficManager *traffic, GameMap *map, const Vehicle *v, float toStopLine) {
+    if (toStopLine <= 0.0f) return false;
 
-        // Despawn if too far
-        float dx_p = v->position.x - player_position.x;
-        float dz_p = v->position.z - player_position.z;
-        if ((dx_p*dx_p + dz_p*dz_p) > DESPAWN_RADIUS * DESPAWN_RADIUS) {
-            v->active = false;
-            continue;
-        }
+    SignalState signal = GetSignalState(&traffic->intersections, map, v->endNodeID, v->startNodeID);
+    return (signal == SIGNAL_RED) ||
+           (signal == SIGNAL_YELLOW && toStopLine > YELLOW_COMMIT_DIST) ||
+           (signal == SIGNAL_STOP && v->clearedNodeID != v->endNodeID);
+}
+
+/*
+ * Description: Sense phase. Computes each vehicle's target speed from the read-only snapshot.
+ * Parameters:
+ * - context: TrafficStepContext.
+ * - start, end: Vehicle index range [start, end).
+ * Returns: None.
+ */
+static void SenseTrafficRange(void *context, int start, int end) {
+    TrafficStepContext *ctx = (TrafficStepContext *)context;
+    TrafficManager *traffic = ctx->traffic;
+    GameMap *map = ctx->map;
+    PROFILE_BEGIN("Traffic Sense");
+
+    for (int i = start; i < end; i++) {
+        const Vehicle *v = &traffic->snapshot[i];
+        if (!v->active || v->isMeso) continue;
 
         Edge currentEdge = map->edges[v->currentEdgeIndex];
 
@@ -261,9 +331,25 @@ void UpdateTraffic(TrafficManager *traffic, Vector3 player_position, GameMap *ma
             }
         }
 
+        // Intersection control (signals / stop signs)
+        bool held = false;
+        if (distRemaining < SIGNAL_LOOKAHEAD) {
+            float toStopLine = distRemaining - STOP_LINE_OFFSET;
+            if (MustStopAtNode(traffic, map, v, toStopLine)) {
+                float blend = toStopLine / (SIGNAL_LOOKAHEAD - STOP_LINE_OFFSET);
+                float stopSpeed = (toStopLine < 0.5f) ? 0.0f : maxEdgeSpeed * blend;
+                if (stopSpeed < targetSpeed) targetSpeed = stopSpeed;
+                held = true;
+            }
+        }
+
         // Obstacle detection (Car ahead)
-        float distToCar = GetDistanceToCarAhead(traffic, i, v->position, v->forward, v->currentEdgeIndex);
+        int aheadIndex;
+        float distToCar = GetDistanceToCarAhead(traffic->snapshot, i, v->position, v->forward, v->currentEdgeIndex, &aheadIndex);
         if (distToCar != -1.0f) {
+            // Queued behind a car that is waiting at a signal counts as waiting too
+            if (traffic->snapshot[aheadIndex].waitingAtSignal) held = true;
+
             if (distToCar < STOP_DISTANCE) targetSpeed = 0.0f; 
             else {
                 float factor = (distToCar - STOP_DISTANCE) / (DETECTION_DIST - STOP_DISTANCE);
@@ -272,7 +358,7 @@ void UpdateTraffic(TrafficManager *traffic, Vector3 player_position, GameMap *ma
         }
 
         // Obstacle detection (Player)
-        float distToPlayer = GetDistanceToPlayer(v->position, v->forward, player_position);
+        float distToPlayer = GetDistanceToPlayer(v->position, v->forward, ctx->playerPos);
         if (distToPlayer != -1.0f) {
             if (distToPlayer < STOP_DISTANCE) targetSpeed = 0.0f; 
             else {
@@ -282,128 +368,704 @@ void UpdateTraffic(TrafficManager *traffic, Vector3 player_position, GameMap *ma
             }
         }
 
+        traffic->targetSpeed[i] = targetSpeed;
+        traffic->heldBySignal[i] = held;
+    }
+    PROFILE_END();
+}
+
+/*
+ * Description: Integrate phase. Applies speed, advances progress and aligns vehicles that stay on their edge.
+ * Parameters:
+ * - context: TrafficStepContext.
+ * - start, end: Vehicle index range [start, end).
+ * Returns: None.
+ */
+static void IntegrateTrafficRange(void *context, int start, int end) {
+    TrafficStepContext *ctx = (TrafficStepContext *)context;
+    TrafficManager *traffic = ctx->traffic;
+    float dt = ctx->dt;
+    PROFILE_BEGIN("Traffic Integrate");
+
+    for (int i = start; i < end; i++) {
+        Vehicle *v = &traffic->vehicles[i];
+        traffic->reachedNode[i] = false;
+        if (!v->active || v->isMeso) continue;
+
+        float targetSpeed = traffic->targetSpeed[i];
+        v->waitingAtSignal = traffic->heldBySignal[i];
+
         // Apply Speed
         v->speed = Lerp(v->speed, targetSpeed, ((v->speed > targetSpeed) ? BRAKE_RATE : ACCEL_RATE) * dt);
 
-        // Stuck removal
-        if (v->speed < 0.2f) {
+        // Stop sign served once the car has (almost) halted at the line
+        if (v->clearedNodeID != v->endNodeID && v->speed < 0.5f &&
+            v->edgeLength * (1.0f - v->progress) - STOP_LINE_OFFSET < 1.5f &&
+            GetSignalState(&traffic->intersections, ctx->map, v->endNodeID, v->startNodeID) == SIGNAL_STOP) {
+            v->clearedNodeID = v->endNodeID;
+        }
+
+        // Stuck removal (queueing at a light or stop sign is not being stuck)
+        if (v->speed < 0.2f && !v->waitingAtSignal) {
              v->stuckTimer += dt;
-             if (v->stuckTimer > STUCK_THRESHOLD) v->active = false; 
+             if (v->stuckTimer > STUCK_THRESHOLD) { v->active = false; continue; }
         } else v->stuckTimer = 0.0f;
 
         // --- MOVEMENT MATH ---
         v->progress += (v->speed * dt) / v->edgeLength;
 
-        // Check if segment completed
+        // Segment completed: picking the next edge is deferred to the serial pass
         if (v->progress >= 1.0f) {
-            int nextEdge = v->nextEdgeIndex;
-            if (nextEdge == -1) nextEdge = v->currentEdgeIndex; 
+            traffic->reachedNode[i] = true;
+            continue;
+        }
 
-            v->currentEdgeIndex = nextEdge;
-            v->startNodeID = v->endNodeID; 
-            
-            Edge nextE = map->edges[v->currentEdgeIndex];
-            v->endNodeID = (nextE.startNode == v->startNodeID) ? nextE.endNode : nextE.startNode;
-            
-            v->progress = 0.0f;
-            v->nextEdgeIndex = FindNextEdge(map, v->endNodeID, v->currentEdgeIndex);
-            
-            v->edgeLength = Vector2Distance(map->nodes[v->startNodeID].position, map->nodes[v->endNodeID].position);
-            currentEdge = nextE; 
+        AlignVehicleToLane(v, ctx->map);
+    }
+    PROFILE_END();
+}
+
+typedef struct MesoQueueEntry {
+    int edge;
+    int startNode;
+    float progress;
+    int index;
+} MesoQueueEntry;
+
+/*
+ * Description: qsort comparator grouping meso vehicles by directed edge, front of the queue first.
+ * Parameters:
+ * - a, b: MesoQueueEntry pointers.
+ * Returns: Sort order.
+ */
+static int CompareMesoQueueEntries(const void *a, const void *b) {
+    const MesoQueueEntry *ea = (const MesoQueueEntry *)a;
+    const MesoQueueEntry *eb = (const MesoQueueEntry *)b;
+    if (ea->edge != eb->edge) return ea->edge - eb->edge;
+    if (ea->startNode != eb->startNode) return ea->startNode - eb->startNode;
+    if (ea->progress != eb->progress) return (ea->progress > eb->progress) ? -1 : 1;
+    return ea->index - eb->index;
+}
+
+/*
+ * Description: Mesoscopic step for distant vehicles. Each directed edge is treated as a queue:
+ * the front car drives at the edge's free-flow speed up to the stop line of a held signal,
+ * every follower is capped so it stays MESO_SPACING behind the car in front. Micro cars are
+ * part of the queues too (as leaders only), so meso cars never drive through them at the LOD
+ * boundary. No lane look-ahead, no neighbour scan.
+ * Parameters:
+ * - traffic: Pointer to TrafficManager.
+ * - map: Pointer to GameMap.
+ * - tickDt: Time accumulated since the last meso tick.
+ * Returns: None.
+ */
+static void UpdateMesoTraffic(TrafficManager *traffic, GameMap *map, float tickDt) {
+    MesoQueueEntry queue[MAX_VEHICLES];
+    int count = 0;
+    bool anyMeso = false;
+
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        Vehicle *v = &traffic->vehicles[i];
+        if (!v->active) continue;
+        queue[count++] = (MesoQueueEntry){ v->currentEdgeIndex, v->startNodeID, v->progress, i };
+        if (v->isMeso) anyMeso = true;
+    }
+    if (!anyMeso) return;
+
+    qsort(queue, count, sizeof(MesoQueueEntry), CompareMesoQueueEntries);
+
+    for (int q = 0; q < count; q++) {
+        Vehicle *v = &traffic->vehicles[queue[q].index];
+        if (!v->isMeso) continue;
+        Edge currentEdge = map->edges[v->currentEdgeIndex];
+
+        float freeSpeed = ((float)currentEdge.maxSpeed) * 0.35f;
+        if (freeSpeed < 4.0f) freeSpeed = 4.0f;
+
+        // How far this car may move before reaching the car in front, a held stop line or a dead end
+        float distRemaining = v->edgeLength * (1.0f - v->progress);
+        float toStopLine = distRemaining - STOP_LINE_OFFSET;
+        bool limited = false;
+        float gap = 0.0f;
+        bool held = false;
+
+        bool hasLeader = (q > 0 && queue[q-1].edge == queue[q].edge && queue[q-1].startNode == queue[q].startNode);
+        if (hasLeader) {
+            Vehicle *leader = &traffic->vehicles[queue[q-1].index];
+            gap = (leader->progress - v->progress) * v->edgeLength - MESO_SPACING;
+            limited = true;
+            held = leader->waitingAtSignal; // Queued behind a held car counts as held too
+        } else if (MustStopAtNode(traffic, map, v, toStopLine)) {
+            gap = toStopLine;
+            limited = true;
+            held = true;
+        } else if (v->nextEdgeIndex == -1) {
+            gap = distRemaining - STOP_DISTANCE;
+            limited = true;
         }
 
-        // --- LANE ALIGNMENT ---
-        Vector2 s2d = map->nodes[v->startNodeID].position;
-        Vector2 e2d = map->nodes[v->endNodeID].position;
-        
-        Vector2 roadDir2D = Vector2Normalize(Vector2Subtract(e2d, s2d));
-        v->forward = (Vector3){ roadDir2D.x, 0, roadDir2D.y };
+        float targetSpeed = freeSpeed;
+        if (limited) {
+            float gapSpeed = (gap > 0.0f) ? gap / tickDt : 0.0f;
+            if (gapSpeed < targetSpeed) targetSpeed = gapSpeed;
+        }
+        v->speed = targetSpeed;
+        v->waitingAtSignal = held;
 
-        Vector2 centerPos2D = Vector2Lerp(s2d, e2d, v->progress);
-        Vector2 rightVec2D = { -roadDir2D.y, roadDir2D.x };
-        
-        float offsetVal = currentEdge.oneway ? 0.0f : (currentEdge.width * 0.25f);
-        
-        v->position.x = centerPos2D.x + (rightVec2D.x * offsetVal);
-        v->position.z = centerPos2D.y + (rightVec2D.y * offsetVal);
-        v->position.y = ROAD_HEIGHT; 
+        // Stop sign served once the car has halted at the line (same rule as the micro update)
+        if (v->clearedNodeID != v->endNodeID && v->speed < 0.5f && toStopLine < 1.5f &&
+            GetSignalState(&traffic->intersections, map, v->endNodeID, v->startNodeID) == SIGNAL_STOP) {
+            v->clearedNodeID = v->endNodeID;
+        }
+
+        // Stuck removal (queueing at a light or stop sign is not being stuck)
+        if (v->speed < 0.2f && !v->waitingAtSignal) {
+             v->stuckTimer += tickDt;
+             if (v->stuckTimer > STUCK_THRESHOLD) { v->active = false; continue; }
+        } else v->stuckTimer = 0.0f;
+
+        v->progress += (v->speed * tickDt) / v->edgeLength;
+
+        if (v->progress >= 1.0f) {
+            traffic->reachedNode[queue[q].index] = true;
+            continue;
+        }
+
+        AlignVehicleToLane(v, map);
     }
 }
 
 /*
- * Description: Renders all active vehicles as simple 3D block models (sedan, van, truck).
+ * Description: Checks that no active vehicle sits within a radius of a point (no side effects, unlike TrafficCollision).
  * Parameters:
  * - traffic: Pointer to TrafficManager.
+ * - pos: Candidate spawn position.
+ * - radius: Required clearance.
+ * Returns: True if the spot is free.
+ */
+static bool IsSpawnPointClear(TrafficManager *traffic, Vector3 pos, float radius) {
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        Vehicle *v = &traffic->vehicles[i];
+        if (!v->active) continue;
+        float dx = v->position.x - pos.x;
+        float dz = v->position.z - pos.z;
+        if (dx*dx + dz*dz < radius * radius) return false;
+    }
+    return true;
+}
+
+/*
+ * Description: Picks the drivable edge leaving a node that points most directly at the player.
+ * Parameters:
+ * - map: Pointer to GameMap.
+ * - nodeID: Spawn node.
+ * - target: Player position (XZ).
+ * - outAlignment: Receives the dot product between edge direction and direction to the player.
+ * Returns: Edge index, or -1 if the node has no drivable exit.
+ */
+static int FindEdgeTowards(GameMap *map, int nodeID, Vector2 target, float *outAlignment) {
+    NodeGraph *node = &map->graph[nodeID];
+    Vector2 nodePos = map->nodes[nodeID].position;
+    Vector2 toTarget = Vector2Normalize(Vector2Subtract(target, nodePos));
+
+    int bestEdge = -1;
+    float bestDot = -2.0f;
+    for (int i = 0; i < node->count; i++) {
+        int edgeIdx = node->connections[i].edgeIndex;
+        Edge e = map->edges[edgeIdx];
+        int otherNode;
+        if (e.startNode == nodeID) otherNode = e.endNode;
+        else if (e.endNode == nodeID && !e.oneway) otherNode = e.startNode;
+        else continue;
+
+        Vector2 dir = Vector2Normalize(Vector2Subtract(map->nodes[otherNode].position, nodePos));
+        float dot = Vector2DotProduct(dir, toTarget);
+        if (dot > bestDot) { bestDot = dot; bestEdge = edgeIdx; }
+    }
+    *outAlignment = bestDot;
+    return bestEdge;
+}
+
+/*
+ * Description: Spawns up to SPAWN_BUDGET vehicles on nodes in the spawn ring around the player.
+ * Candidates come from the node grid cells covering the ring, so cost and density do not
+ * depend on how big the map is. Edges heading toward the player are preferred so new cars
+ * drive into view instead of away from it.
+ * Parameters:
+ * - traffic: Pointer to TrafficManager.
+ * - map: Pointer to GameMap.
+ * - playerPos: Player's position.
  * Returns: None.
  */
-void DrawTraffic(TrafficManager *traffic) {
-    float time = (float)GetTime();
+static void SpawnTrafficNearPlayer(TrafficManager *traffic, GameMap *map, Vector3 playerPos) {
+    static int ringNodes[MAX_RING_NODES];
+    Vector2 player2D = { playerPos.x, playerPos.z };
+
+    int ringCount = GetNodesInRing(map, player2D, SPAWN_RADIUS_MIN, SPAWN_RADIUS_MAX, ringNodes, MAX_RING_NODES);
+    if (ringCount == 0) return;
+
+    int slot = 0;
+    int spawned = 0;
+    for (int attempt = 0; attempt < SPAWN_ATTEMPTS && spawned < SPAWN_BUDGET; attempt++) {
+        while (slot < MAX_VEHICLES && traffic->vehicles[slot].active) slot++;
+        if (slot >= MAX_VEHICLES) return;
 
+        int nodeID = ringNodes[GetRandomValue(0, ringCount - 1)];
+        float alignment;
+        int edgeIdx = FindEdgeTowards(map, nodeID, player2D, &alignment);
+        if (edgeIdx == -1) continue;
+
+        // Cars heading away from the player are only kept occasionally
+        if (alignment < 0.0f && GetRandomValue(0, 3) != 0) continue;
+
+        Edge e = map->edges[edgeIdx];
+        Vehicle candidate = { 0 };
+        candidate.active = true;
+        candidate.clearedNodeID = -1;
+        candidate.currentEdgeIndex = edgeIdx;
+        candidate.startNodeID = nodeID;
+        candidate.endNodeID = (e.startNode == nodeID) ? e.endNode : e.startNode;
+        candidate.progress = 0.1f;
+        candidate.edgeLength = Vector2Distance(map->nodes[e.startNode].position, map->nodes[e.endNode].position);
+        if (candidate.edgeLength < 0.01f) continue;
+        AlignVehicleToLane(&candidate, map);
+
+        if (!IsSpawnPointClear(traffic, candidate.position, STOP_DISTANCE)) continue;
+
+        candidate.nextEdgeIndex = FindNextEdge(map, candidate.endNodeID, candidate.currentEdgeIndex);
+        candidate.color = (Color){ GetRandomValue(80, 200), GetRandomValue(80, 200), GetRandomValue(80, 200), 255 };
+        float dx = candidate.position.x - playerPos.x;
+        float dz = candidate.position.z - playerPos.z;
+        candidate.isMeso = (dx*dx + dz*dz > MICRO_RADIUS * MICRO_RADIUS);
+
+        traffic->vehicles[slot] = candidate;
+        spawned++;
+    }
+}
+
+/*
+ * Description: Updates logic for all traffic vehicles: spawning, movement, pathfinding, and obstacle avoidance.
+ * Parameters:
+ * - traffic: Pointer to TrafficManager.
+ * - player_position: Player's position (for spawn/despawn logic).
+ * - map: Pointer to GameMap.
+ * - dt: Delta Time.
+ * Returns: None.
+ */
+void UpdateTraffic(TrafficManager *traffic, Vector3 player_position, GameMap *map, float dt) {
+    if (map->edgeCount == 0 || map->nodeCount == 0 || !map->graph) return;
+
+    if (traffic->intersections.nodeCount != map->nodeCount) InitIntersections(&traffic->intersections, map);
+    UpdateIntersections(&traffic->intersections, dt);
+
+    // --- 1. SPAWNING LOGIC ---
+    traffic->spawnTimer += dt;
+    if (traffic->spawnTimer > SPAWN_INTERVAL) {
+        traffic->spawnTimer = 0.0f;
+        SpawnTrafficNearPlayer(traffic, map, player_position);
+    }
+
+    // --- 2. DESPAWN & LOD TIER (Serial) ---
     for (int i = 0; i < MAX_VEHICLES; i++) {
         Vehicle *v = &traffic->vehicles[i];
         if (!v->active) continue;
 
-        // 1. Calculate the standard road angle
-        float roadAngle = (atan2f(v->forward.x, v->forward.z) * RAD2DEG);
-
-        // 2. Selection of Car Type
-        int type = i % 3; 
-        Vector3 chassisSize, cabinSize;
-        float cabinYOffset, cabinZOffset;
-
-        if (type == 1) { // Van
-            chassisSize = (Vector3){ 0.75f, 0.4f, 1.5f };
-            cabinSize   = (Vector3){ 0.65f, 0.4f, 1.1f };
-            cabinYOffset = 0.35f; cabinZOffset = 0.1f;
-        } else if (type == 2) { // Long Truck
-            chassisSize = (Vector3){ 0.7f, 0.35f, 1.9f };
-            cabinSize   = (Vector3){ 0.6f, 0.4f, 0.6f };
-            cabinYOffset = 0.35f; cabinZOffset = 0.5f;
-        } else { // Sedan
-            chassisSize = (Vector3){ 0.7f, 0.35f, 1.3f };
-            cabinSize   = (Vector3){ 0.6f, 0.3f, 0.7f };
-            cabinYOffset = 0.3f; cabinZOffset = -0.1f;
+        float dx_p = v->position.x - player_position.x;
+        float dz_p = v->position.z - player_position.z;
+        float distSq = dx_p*dx_p + dz_p*dz_p;
+        if (distSq > DESPAWN_RADIUS * DESPAWN_RADIUS) { v->active = false; continue; }
+
+        // Promotion keeps speed/edge/progress, so the car just carries on at full detail
+        if (v->isMeso && distSq < MICRO_RADIUS * MICRO_RADIUS) v->isMeso = false;
+        else if (!v->isMeso && distSq > MESO_RADIUS * MESO_RADIUS) v->isMeso = true;
+    }
+
+    // --- 3. PARALLEL TWO-PHASE STEP ---
+    // Sense reads only the snapshot (front buffer), integrate writes only its own
+    // vehicle (back buffer). Every vehicle sees the same neighbour state no matter
+    // how the range is split, so the result is identical for any thread count.
+    memcpy(traffic->snapshot, traffic->vehicles, sizeof(traffic->vehicles));
+
+    TrafficStepContext ctx = { traffic, map, player_position, dt };
+    ParallelFor(MAX_VEHICLES, TRAFFIC_MIN_BATCH, SenseTrafficRange, &ctx);
+    ParallelFor(MAX_VEHICLES, TRAFFIC_MIN_BATCH, IntegrateTrafficRange, &ctx);
+
+    // Distant cars: cheap queue update a few times per second
+    traffic->mesoTimer += dt;
+    if (traffic->mesoTimer >= MESO_TICK_INTERVAL) {
+        UpdateMesoTraffic(traffic, map, traffic->mesoTimer);
+        traffic->mesoTimer = 0.0f;
+    }
+
+    // --- 4. INTERSECTIONS (Serial) ---
+    // FindNextEdge draws from the global RNG, so route picks stay on this thread in index order.
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        if (!traffic->reachedNode[i]) continue;
+        Vehicle *v = &traffic->vehicles[i];
+
+        int nextEdge = v->nextEdgeIndex;
+        if (nextEdge == -1) nextEdge = v->currentEdgeIndex; 
+
+        v->currentEdgeIndex = nextEdge;
+        v->startNodeID = v->endNodeID; 
+        
+        Edge nextE = map->edges[v->currentEdgeIndex];
+        v->endNodeID = (nextE.startNode == v->startNodeID) ? nextE.endNode : nextE.startNode;
+        
+        v->progress = 0.0f;
+        v->nextEdgeIndex = FindNextEdge(map, v->endNodeID, v->currentEdgeIndex);
+        
+        v->edgeLength = Vector2Distance(map->nodes[v->startNodeID].position, map->nodes[v->endNodeID].position);
+        AlignVehicleToLane(v, map);
+    }
+}
+
+/*
+ * Description: Copies every active vehicle into compact save records.
+ * Parameters:
+ * - traffic: Pointer to TrafficManager.
+ * - out: Record array to fill.
+ * - maxRecords: Capacity of out.
+ * Returns: Number of records written.
+ */
+int PackTrafficState(const TrafficManager *traffic, TrafficSaveRecord *out, int maxRecords) {
+    int count = 0;
+    for (int i = 0; i < MAX_VEHICLES && count < maxRecords; i++) {
+        const Vehicle *v = &traffic->vehicles[i];
+        if (!v->active) continue;
+
+        TrafficSaveRecord *r = &out[count++];
+        memset(r, 0, sizeof(*r)); // Records go to disk as-is, keep the padding deterministic
+        r->currentEdgeIndex = v->currentEdgeIndex;
+        r->nextEdgeIndex = v->nextEdgeIndex;
+        r->startNodeID = v->startNodeID;
+        r->endNodeID = v->endNodeID;
+        r->clearedNodeID = v->clearedNodeID;
+        r->progress = v->progress;
+        r->speed = v->speed;
+        r->stuckTimer = v->stuckTimer;
+        r->color = v->color;
+        r->isMeso = v->isMeso;
+        r->waitingAtSignal = v->waitingAtSignal;
+    }
+    return count;
+}
+
+/*
+ * Description: Replaces the current traffic with saved vehicles, re-deriving lane placement from the map.
+ * Records that do not fit the map's road graph are dropped; the spawner refills the gap.
+ * Parameters:
+ * - traffic: Pointer to TrafficManager.
+ * - map: Pointer to GameMap the records were saved on.
+ * - records: Saved vehicles.
+ * - count: Number of records.
+ * Returns: Number of vehicles restored.
+ */
+int RestoreTrafficState(TrafficManager *traffic, GameMap *map, const TrafficSaveRecord *records, int count) {
+    for (int i = 0; i < MAX_VEHICLES; i++) traffic->vehicles[i].active = false;
+
+    int restored = 0;
+    for (int i = 0; i < count && restored < MAX_VEHICLES; i++) {
+        const TrafficSaveRecord *r = &records[i];
+        if (r->currentEdgeIndex < 0 || r->currentEdgeIndex >= map->edgeCount) continue;
+        if (r->nextEdgeIndex < -1 || r->nextEdgeIndex >= map->edgeCount) continue;
+
+        Edge e = map->edges[r->currentEdgeIndex];
+        bool forward = (e.startNode == r->startNodeID && e.endNode == r->endNodeID);
+        bool reverse = (e.startNode == r->endNodeID && e.endNode == r->startNodeID);
+        if (!forward && !reverse) continue;
+
+        Vehicle v = { 0 };
+        v.active = true;
+        v.currentEdgeIndex = r->currentEdgeIndex;
+        v.nextEdgeIndex = r->nextEdgeIndex;
+        v.startNodeID = r->startNodeID;
+        v.endNodeID = r->endNodeID;
+        v.clearedNodeID = r->clearedNodeID;
+        v.progress = Clamp(r->progress, 0.0f, 1.0f);
+        v.speed = r->speed;
+        v.stuckTimer = r->stuckTimer;
+        v.color = r->color;
+        v.isMeso = r->isMeso;
+        v.waitingAtSignal = r->waitingAtSignal;
+        v.edgeLength = Vector2Distance(map->nodes[v.startNodeID].position, map->nodes[v.endNodeID].position);
+        if (v.edgeLength < 0.01f) continue;
+        AlignVehicleToLane(&v, map);
+
+        traffic->vehicles[restored++] = v;
+    }
+    return restored;
+}
+
+/*
+ * Description: Returns the block dimensions for one of the three vehicle shapes.
+ * Parameters:
+ * - type: 0 = Sedan, 1 = Van, 2 = Long Truck.
+ * - chassisSize, cabinSize: Output box sizes.
+ * - cabinYOffset, cabinZOffset: Output cabin offset from the chassis center.
+ * Returns: None.
+ */
+static void GetVehicleShape(int type, Vector3 *chassisSize, Vector3 *cabinSize, float *cabinYOffset, float *cabinZOffset) {
+    if (type == 1) { // Van
+        *chassisSize = (Vector3){ 0.75f, 0.4f, 1.5f };
+        *cabinSize   = (Vector3){ 0.65f, 0.4f, 1.1f };
+        *cabinYOffset = 0.35f; *cabinZOffset = 0.1f;
+    } else if (type == 2) { // Long Truck
+        *chassisSize = (Vector3){ 0.7f, 0.35f, 1.9f };
+        *cabinSize   = (Vector3){ 0.6f, 0.4f, 0.6f };
+        *cabinYOffset = 0.35f; *cabinZOffset = 0.5f;
+    } else { // Sedan
+        *chassisSize = (Vector3){ 0.7f, 0.35f, 1.3f };
+        *cabinSize   = (Vector3){ 0.6f, 0.3f, 0.7f };
+        *cabinYOffset = 0.3f; *cabinZOffset = -0.1f;
+    }
+}
+
+/*
+ * Description: Appends an axis-aligned box (36 vertices) to a vehicle mesh, tagging it with a part id.
+ * Parameters:
+ * - mesh: Target mesh (arrays preallocated).
+ * - vertexIndex: Running vertex counter.
+ * - center: Box center in model space.
+ * - size: Box dimensions.
+ * - part: TRAFFIC_PART_* id, stored in the red vertex color channel.
+ * Returns: None.
+ */
+static void AppendVehicleBox(Mesh *mesh, int *vertexIndex, Vector3 center, Vector3 size, unsigned char part) {
+    const Vector3 normals[6] = { {0,0,1}, {0,0,-1}, {0,1,0}, {0,-1,0}, {1,0,0}, {-1,0,0} };
+    // Corners per face, counter-clockwise seen from outside
+    const Vector3 corners[6][4] = {
+        { {-1,-1, 1}, { 1,-1, 1}, { 1, 1, 1}, {-1, 1, 1} }, // Front
+        { { 1,-1,-1}, {-1,-1,-1}, {-1, 1,-1}, { 1, 1,-1} }, // Back
+        { {-1, 1, 1}, { 1, 1, 1}, { 1, 1,-1}, {-1, 1,-1} }, // Top
+        { {-1,-1,-1}, { 1,-1,-1}, { 1,-1, 1}, {-1,-1, 1} }, // Bottom
+        { { 1,-1, 1}, { 1,-1,-1}, { 1, 1,-1}, { 1, 1, 1} }, // Right
+        { {-1,-1,-1}, {-1,-1, 1}, {-1, 1, 1}, {-1, 1,-1} }  // Left
+    };
+    const int quadToTris[6] = { 0, 1, 2, 0, 2, 3 };
+
+    for (int f = 0; f < 6; f++) {
+        for (int k = 0; k < 6; k++) {
+            Vector3 c = corners[f][quadToTris[k]];
+            int v = (*vertexIndex)++;
+            mesh->vertices[v*3 + 0] = center.x + c.x * size.x * 0.5f;
+            mesh->vertices[v*3 + 1] = center.y + c.y * size.y * 0.5f;
+            mesh->vertices[v*3 + 2] = center.z + c.z * size.z * 0.5f;
+            mesh->normals[v*3 + 0] = normals[f].x;
+            mesh->normals[v*3 + 1] = normals[f].y;
+            mesh->normals[v*3 + 2] = normals[f].z;
+            mesh->colors[v*4 + 0] = part;
+            mesh->colors[v*4 + 1] = 0;
+            mesh->colors[v*4 + 2] = 0;
+            mesh->colors[v*4 + 3] = 255;
         }
+    }
+}
 
-        rlPushMatrix();
-            // A. Move to world position
-            rlTranslatef(v->position.x, v->position.y, v->position.z);
-            
-            // B. Rotate to match road direction
-            rlRotatef(roadAngle, 0, 1, 0); 
+/*
+ * Description: Builds the single-mesh version of a vehicle shape (chassis, cabin, windshield, lights).
+ * Parameters:
+ * - type: Vehicle shape (see GetVehicleShape).
+ * Returns: CPU-side Mesh ready for UploadMesh.
+ */
+static Mesh GenVehicleMesh(int type) {
+    Vector3 chassisSize, cabinSize;
+    float cabinYOffset, cabinZOffset;
+    GetVehicleShape(type, &chassisSize, &cabinSize, &cabinYOffset, &cabinZOffset);
 
-            // C. Rotate the "Model" 10 degrees clockwise for alignment fix
-            rlRotatef(-10.0f, 0, 1, 0); 
+    const int boxCount = 7;
+    Mesh mesh = { 0 };
+    mesh.vertexCount = boxCount * 36;
+    mesh.triangleCount = boxCount * 12;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount * 3 * sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount * 3 * sizeof(float));
+    mesh.colors = (unsigned char *)RL_MALLOC(mesh.vertexCount * 4 * sizeof(unsigned char));
 
-            // 1. Chassis
-            DrawCube((Vector3){0, 0, 0}, chassisSize.x, chassisSize.y, chassisSize.z, v->color);
-            DrawCubeWires((Vector3){0, 0, 0}, chassisSize.x, chassisSize.y, chassisSize.z, DARKGRAY);
+    float backZ = -chassisSize.z * 0.5f;
+    float frontZ = chassisSize.z * 0.5f;
+    int vi = 0;
 
-            // 2. Cabin
-            Vector3 localCabinPos = { 0.0f, cabinYOffset, cabinZOffset };
-            DrawCube(localCabinPos, cabinSize.x, cabinSize.y, cabinSize.z, Fade(v->color, 0.8f));
-            DrawCubeWires(localCabinPos, cabinSize.x, cabinSize.y, cabinSize.z, DARKGRAY);
+    AppendVehicleBox(&mesh, &vi, (Vector3){ 0, 0, 0 }, chassisSize, TRAFFIC_PART_BODY);
+    AppendVehicleBox(&mesh, &vi, (Vector3){ 0, cabinYOffset, cabinZOffset }, cabinSize, TRAFFIC_PART_CABIN);
+    AppendVehicleBox(&mesh, &vi, (Vector3){ 0, cabinYOffset, (cabinSize.z * 0.45f) + cabinZOffset },
+                     (Vector3){ cabinSize.x * 1.02f, cabinSize.y * 0.6f, 0.05f }, TRAFFIC_PART_GLASS);
+    AppendVehicleBox(&mesh, &vi, (Vector3){ -0.25f, 0.05f, backZ }, (Vector3){ 0.15f, 0.1f, 0.05f }, TRAFFIC_PART_BRAKE);
+    AppendVehicleBox(&mesh, &vi, (Vector3){  0.25f, 0.05f, backZ }, (Vector3){ 0.15f, 0.1f, 0.05f }, TRAFFIC_PART_BRAKE);
+    AppendVehicleBox(&mesh, &vi, (Vector3){ -0.25f, 0.0f, frontZ }, (Vector3){ 0.2f, 0.15f, 0.02f }, TRAFFIC_PART_HEADLIGHT);
+    AppendVehicleBox(&mesh, &vi, (Vector3){  0.25f, 0.0f, frontZ }, (Vector3){ 0.2f, 0.15f, 0.02f }, TRAFFIC_PART_HEADLIGHT);
 
-            // 3. Windshield
-            Vector3 localGlassPos = { 0.0f, cabinYOffset, (cabinSize.z * 0.45f) + cabinZOffset };
-            DrawCube(localGlassPos, cabinSize.x * 1.02f, cabinSize.y * 0.6f, 0.05f, (Color){ 100, 180, 255, 180 });
+    return mesh;
+}
 
-            // 4. Lights
-            float backZ = -chassisSize.z * 0.5f;
-            float frontZ = chassisSize.z * 0.5f;
+/*
+ * Description: Loads the traffic shader, uploads one mesh per vehicle shape and attaches a
+ * per-instance buffer (transform + color/brake) to each mesh's vertex array. Runs once.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void LoadTrafficRenderer(void) {
+    if (trafficRenderer.loaded) return;
+    trafficRenderer.loaded = true;
+    trafficRenderer.instanced = false;
 
-            // Brake Lights
-            if (v->speed < 3.0f) {
-                DrawCube((Vector3){-0.25f, 0.05f, backZ}, 0.15f, 0.1f, 0.05f, RED);
-                DrawCube((Vector3){ 0.25f, 0.05f, backZ}, 0.15f, 0.1f, 0.05f, RED);
-            }
+    if (!FileExists("resources/shaders/traffic.vs") || !FileExists("resources/shaders/traffic.fs")) {
+        TraceLog(LOG_WARNING, "TRAFFIC: Instancing shader missing, using immediate mode.");
+        return;
+    }
 
-            // Headlights
-            DrawCube((Vector3){-0.25f, 0.0f, frontZ}, 0.2f, 0.15f, 0.02f, RAYWHITE);
-            DrawCube((Vector3){ 0.25f, 0.0f, frontZ}, 0.2f, 0.15f, 0.02f, RAYWHITE);
+    Shader shader = LoadShader("resources/shaders/traffic.vs", "resources/shaders/traffic.fs");
+    int locTransform = GetShaderLocationAttrib(shader, "instanceTransform");
+    int locColor = GetShaderLocationAttrib(shader, "instanceColor");
+    if (shader.id == rlGetShaderIdDefault() || locTransform < 0 || locColor < 0) {
+        TraceLog(LOG_WARNING, "TRAFFIC: Instancing shader failed, using immediate mode.");
+        if (shader.id != rlGetShaderIdDefault()) UnloadShader(shader);
+        return;
+    }
+
+    trafficRenderer.shader = shader;
+    trafficRenderer.locMvp = GetShaderLocation(shader, "mvp");
+
+    for (int t = 0; t < TRAFFIC_TYPE_COUNT; t++) {
+        trafficRenderer.meshes[t] = GenVehicleMesh(t);
+        UploadMesh(&trafficRenderer.meshes[t], false);
+
+        rlEnableVertexArray(trafficRenderer.meshes[t].vaoId);
+        trafficRenderer.instanceVbo[t] = rlLoadVertexBuffer(NULL, MAX_VEHICLES * sizeof(TrafficInstance), true);
+
+        // mat4 attribute spans 4 consecutive vec4 slots
+        for (int k = 0; k < 4; k++) {
+            rlEnableVertexAttribute(locTransform + k);
+            rlSetVertexAttribute(locTransform + k, 4, RL_FLOAT, false, sizeof(TrafficInstance), k * 4 * sizeof(float));
+            rlSetVertexAttributeDivisor(locTransform + k, 1);
+        }
+        rlEnableVertexAttribute(locColor);
+        rlSetVertexAttribute(locColor, 4, RL_FLOAT, false, sizeof(TrafficInstance), 16 * sizeof(float));
+        rlSetVertexAttributeDivisor(locColor, 1);
+
+        rlDisableVertexBuffer();
+        rlDisableVertexArray();
+    }
+
+    trafficRenderer.instanced = true;
+}
+
+/*
+ * Description: Releases the traffic meshes, instance buffers and shader.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UnloadTrafficRenderer(void) {
+    if (!trafficRenderer.loaded) return;
 
-        rlPopMatrix();
+    if (trafficRenderer.instanced) {
+        for (int t = 0; t < TRAFFIC_TYPE_COUNT; t++) {
+            rlUnloadVertexBuffer(trafficRenderer.instanceVbo[t]);
+            UnloadMesh(trafficRenderer.meshes[t]);
+        }
+        UnloadShader(trafficRenderer.shader);
     }
+
+    trafficRenderer.loaded = false;
+    trafficRenderer.instanced = false;
+}
+
+/*
+ * Description: Fallback renderer (no GL 3.3 / shader missing). Draws one vehicle with immediate-mode cubes.
+ * Parameters:
+ * - v: Vehicle to draw.
+ * - type: Vehicle shape.
+ * Returns: None.
+ */
+static void DrawVehicleImmediate(Vehicle *v, int type) {
+    float roadAngle = (atan2f(v->forward.x, v->forward.z) * RAD2DEG);
+
+    Vector3 chassisSize, cabinSize;
+    float cabinYOffset, cabinZOffset;
+    GetVehicleShape(type, &chassisSize, &cabinSize, &cabinYOffset, &cabinZOffset);
+
+    rlPushMatrix();
+        rlTranslatef(v->position.x, v->position.y, v->position.z);
+        rlRotatef(roadAngle + VEHICLE_MODEL_YAW_FIX, 0, 1, 0); 
+
+        DrawCube((Vector3){0, 0, 0}, chassisSize.x, chassisSize.y, chassisSize.z, v->color);
+        DrawCubeWires((Vector3){0, 0, 0}, chassisSize.x, chassisSize.y, chassisSize.z, DARKGRAY);
+
+        Vector3 localCabinPos = { 0.0f, cabinYOffset, cabinZOffset };
+        DrawCube(localCabinPos, cabinSize.x, cabinSize.y, cabinSize.z, Fade(v->color, 0.8f));
+        DrawCubeWires(localCabinPos, cabinSize.x, cabinSize.y, cabinSize.z, DARKGRAY);
+
+        Vector3 localGlassPos = { 0.0f, cabinYOffset, (cabinSize.z * 0.45f) + cabinZOffset };
+        DrawCube(localGlassPos, cabinSize.x * 1.02f, cabinSize.y * 0.6f, 0.05f, (Color){ 100, 180, 255, 180 });
+
+        float backZ = -chassisSize.z * 0.5f;
+        float frontZ = chassisSize.z * 0.5f;
+
+        if (v->speed < BRAKE_LIGHT_SPEED) {
+            DrawCube((Vector3){-0.25f, 0.05f, backZ}, 0.15f, 0.1f, 0.05f, RED);
+            DrawCube((Vector3){ 0.25f, 0.05f, backZ}, 0.15f, 0.1f, 0.05f, RED);
+        }
+
+        DrawCube((Vector3){-0.25f, 0.0f, frontZ}, 0.2f, 0.15f, 0.02f, RAYWHITE);
+        DrawCube((Vector3){ 0.25f, 0.0f, frontZ}, 0.2f, 0.15f, 0.02f, RAYWHITE);
+    rlPopMatrix();
+}
+
+/*
+ * Description: Renders all active vehicles (sedan, van, truck). Cars are bucketed by shape into
+ * instance buffers and drawn with one instanced call per shape.
+ * Parameters:
+ * - traffic: Pointer to TrafficManager.
+ * Returns: None.
+ */
+void DrawTraffic(TrafficManager *traffic) {
+    LoadTrafficRenderer();
+
+    if (!trafficRenderer.instanced) {
+        for (int i = 0; i < MAX_VEHICLES; i++) {
+            Vehicle *v = &traffic->vehicles[i];
+            if (!v->active || v->isMeso) continue;
+            DrawVehicleImmediate(v, i % 3);
+        }
+        return;
+    }
+
+    // 1. Fill instance data
+    int counts[TRAFFIC_TYPE_COUNT] = { 0 };
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        Vehicle *v = &traffic->vehicles[i];
+        if (!v->active || v->isMeso) continue; // Meso cars are beyond draw distance
+
+        int type = i % 3;
+        float yaw = (atan2f(v->forward.x, v->forward.z) * RAD2DEG + VEHICLE_MODEL_YAW_FIX) * DEG2RAD;
+        Matrix transform = MatrixMultiply(MatrixRotateY(yaw), MatrixTranslate(v->position.x, v->position.y, v->position.z));
+
+        TrafficInstance *inst = &trafficRenderer.instances[type][counts[type]++];
+        float16 m = MatrixToFloatV(transform);
+        memcpy(inst->transform, m.v, sizeof(inst->transform));
+        inst->color[0] = v->color.r / 255.0f;
+        inst->color[1] = v->color.g / 255.0f;
+        inst->color[2] = v->color.b / 255.0f;
+        inst->color[3] = (v->speed < BRAKE_LIGHT_SPEED) ? 1.0f : 0.0f;
+    }
+
+    // 2. Flush raylib's batch so depth/blend order matches everything drawn before us
+    rlDrawRenderBatchActive();
+
+    Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+    rlEnableShader(trafficRenderer.shader.id);
+    rlSetUniformMatrix(trafficRenderer.locMvp, mvp);
+
+    // 3. One draw per shape
+    for (int t = 0; t < TRAFFIC_TYPE_COUNT; t++) {
+        if (counts[t] == 0) continue;
+        rlUpdateVertexBuffer(trafficRenderer.instanceVbo[t], trafficRenderer.instances[t], counts[t] * sizeof(TrafficInstance), 0);
+        rlEnableVertexArray(trafficRenderer.meshes[t].vaoId);
+        rlDrawVertexArrayInstanced(0, trafficRenderer.meshes[t].vertexCount, counts[t]);
+        PerfCountDraw(1, trafficRenderer.meshes[t].triangleCount * counts[t]);
+        rlDisableVertexArray();
+    }
+
+    rlDisableShader();
 }
 
 /*
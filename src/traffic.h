@@ -18,10 +18,11 @@
 #define TRAFFIC_H
 
 #include "raylib.h"
+#include "intersection.h"
 
 typedef struct GameMap GameMap;
 
-#define MAX_VEHICLES 150
+#define MAX_VEHICLES 300
 
 typedef struct Vehicle {
     bool active;
@@ -41,16 +42,53 @@ typedef struct Vehicle {
     
     // Anti-Gridlock
     float stuckTimer;     
+
+    // Level of detail: true = distant, updated as an edge queue at a low tick rate
+    bool isMeso;
+
+    // Intersection control
+    int clearedNodeID;      // Stop sign already served at this node
+    bool waitingAtSignal;   // Held by a red light / stop sign (directly or queued behind)
 } Vehicle;
 
 typedef struct TrafficManager {
     Vehicle vehicles[MAX_VEHICLES];
+
+    // Double-buffered step state (see UpdateTraffic)
+    Vehicle snapshot[MAX_VEHICLES];   // Read-only front buffer for the sense phase
+    float targetSpeed[MAX_VEHICLES];  // Sense phase output
+    bool reachedNode[MAX_VEHICLES];   // Integrate phase output, resolved serially
+    bool heldBySignal[MAX_VEHICLES];  // Sense phase output
+
+    IntersectionSystem intersections; // Built on the first update for the current map
+
+    float spawnTimer;                 // Time since the last spawn pass
+    float mesoTimer;                  // Time since the last meso tick
 } TrafficManager;
 
+// Compact per-vehicle state for save files; lane position, length and heading are rebuilt from the map
+typedef struct TrafficSaveRecord {
+    int currentEdgeIndex;
+    int nextEdgeIndex;
+    int startNodeID;
+    int endNodeID;
+    int clearedNodeID;
+    float progress;
+    float speed;
+    float stuckTimer;
+    Color color;
+    unsigned char isMeso;
+    unsigned char waitingAtSignal;
+} TrafficSaveRecord;
+
 void InitTraffic(TrafficManager *traffic);
+void UnloadTraffic(TrafficManager *traffic);
 void UpdateTraffic(TrafficManager *traffic, Vector3 player_position, GameMap *map, float dt);
 void DrawTraffic(TrafficManager *traffic);
+void UnloadTrafficRenderer(void);
 Vector3 TrafficCollision(TrafficManager *traffic, float playerPosx, float playerPosz, float player_radius);
 int FindNextEdge(GameMap *map, int nodeID, int excludeEdgeIndex);
+int PackTrafficState(const TrafficManager *traffic, TrafficSaveRecord *out, int maxRecords);
+int RestoreTrafficState(TrafficManager *traffic, GameMap *map, const TrafficSaveRecord *records, int count);
 
 #endif
\ No newline at end of file
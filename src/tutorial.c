@@ -15,6 +15,7 @@
  */
 
 #include "tutorial.h"
+#include "delivery_app.h"
 #include "raylib.h"
 #include "raymath.h" 
 #include <stdio.h>
@@ -92,7 +93,7 @@ static void ForceSpawnJob(PhoneState *phone, GameMap *map, bool isFragile) {
         phone->tasks[0].pay = 150.0f; 
         phone->tasks[0].maxPay = 150.0f; 
         phone->tasks[0].distance = Vector2Distance(phone->tasks[0].restaurantPos, phone->tasks[0].customerPos);
-        phone->tasks[0].creationTime = GetTime();
+        phone->tasks[0].creationTime = GetDeliveryClock();
         
         // Reset Constraints
         phone->tasks[0].fragility = 0.0f;
@@ -0,0 +1,63 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#include "bench_common.h"
+#include <time.h>
+#include <math.h>
+
+/*
+ * Description: Wall clock in milliseconds.
+ * Parameters: None.
+ * Returns: Time in milliseconds.
+ */
+double NowMs(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+/*
+ * Description: Wall clock in microseconds.
+ * Parameters: None.
+ * Returns: Time in microseconds.
+ */
+double NowUs(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1.0e6 + (double)ts.tv_nsec / 1.0e3;
+}
+
+int CompareDoubles(const void *a, const void *b) {
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+/*
+ * Description: Returns the given percentile of a sorted sample array.
+ * Parameters:
+ * - sorted: Samples in ascending order.
+ * - count: Number of samples.
+ * - pct: Percentile (0-100).
+ * Returns: The sample value.
+ */
+double Percentile(const double *sorted, int count, double pct) {
+    if (count == 0) return 0.0;
+    int idx = (int)ceil(pct / 100.0 * count) - 1;
+    if (idx < 0) idx = 0;
+    if (idx >= count) idx = count - 1;
+    return sorted[idx];
+}
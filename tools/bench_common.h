@@ -0,0 +1,32 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+// Timing and statistics helpers shared by the headless tools (headless_sim, map_bench).
+
+// Wall clock (C11 timespec_get, works on every target)
+double NowMs(void);
+double NowUs(void);
+
+// qsort comparator for ascending doubles
+int CompareDoubles(const void *a, const void *b);
+
+// Nearest-rank percentile (0-100) of samples already sorted ascending
+double Percentile(const double *sorted, int count, double pct);
+
+#endif
@@ -0,0 +1,394 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+// --- HEADLESS SIMULATION / BENCHMARK HARNESS ---
+// Runs the game simulation without a window: loads a map, drives the player along
+// routed delivery jobs, and steps traffic, sector streaming (CPU bakes only) and job
+// generation at a fixed dt. Prints per-subsystem timings at the end.
+//
+// Build: premake target "headless_sim" (see build/premake5.lua). Run from the repo root:
+//   headless_sim --map resources/Maps/real_city.map --seconds 120 --dt 0.016667 --seed 1234
+
+#include "raylib.h"
+#include "raymath.h"
+#include "map.h"
+#include "player.h"
+#include "traffic.h"
+#include "phone.h"
+#include "delivery_app.h"
+#include "thread_pool.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// --- CONFIGURATION ---
+#define SIM_DEFAULT_MAP "resources/Maps/real_city.map"
+#define SIM_DEFAULT_SECONDS 60.0f
+#define SIM_DEFAULT_DT (1.0f / 60.0f)
+#define SIM_MAX_ROUTE 2048
+#define SIM_WAYPOINT_RADIUS 6.0f     // Distance at which a route point counts as reached
+#define SIM_ARRIVE_RADIUS 8.0f       // Distance to the job zone that completes a leg
+#define SIM_CRUISE_SPEED 14.0f
+#define SIM_CORNER_SPEED 6.0f
+#define SIM_STUCK_TIME 1.5f          // Seconds without progress before backing up
+#define SIM_REVERSE_TIME 1.0f
+#define SIM_MAX_REVERSES 1           // Failed back-ups before the car is placed on the waypoint
+
+typedef enum {
+    SIM_PLAYER = 0,
+    SIM_TRAFFIC,
+    SIM_STREAMING,
+    SIM_JOBS,
+    SIM_ROUTING,
+    SIM_STEP,
+    SIM_COUNT
+} SimSubsystem;
+
+static const char *simNames[SIM_COUNT] = {
+    "Player", "Traffic", "Streaming", "Jobs", "Routing", "Step (total)"
+};
+
+// Per-step samples (ms). Routing only records steps that actually searched.
+typedef struct {
+    double *samples;
+    int count;
+} SimTimings;
+
+// Scripted driver state
+typedef struct {
+    int taskIndex;                // -1 = looking for a job
+    Vector2 route[SIM_MAX_ROUTE];
+    int routeLen;
+    int routeIndex;
+    float noProgressTimer;
+    float reverseTimer;
+    int reverseAttempts;          // Back-ups spent on the current waypoint
+    float bestDist;               // Closest we have been to the current waypoint
+} SimDriver;
+
+// --- STATS ---
+static int deliveriesDone = 0;
+static int routesPlanned = 0;
+static int routesFailed = 0;
+static int rescues = 0;
+static double distanceDriven = 0.0;
+
+/*
+ * Description: Plans a route from the player to the zone of the task's current leg.
+ * Parameters:
+ * - driver: Driver state to fill.
+ * - map: Pointer to the GameMap.
+ * - from: Player position.
+ * - to: Leg destination.
+ * - timings: Routing timings.
+ * Returns: True if a route was found.
+ */
+static bool PlanRoute(SimDriver *driver, GameMap *map, Vector3 from, Vector3 to, SimTimings *timings) {
+    double t0 = NowMs();
+    int len = FindPath(map, (Vector2){ from.x, from.z }, (Vector2){ to.x, to.z }, driver->route, SIM_MAX_ROUTE - 1);
+    timings->samples[timings->count++] = NowMs() - t0;
+
+    routesPlanned++;
+    if (len <= 0) {
+        routesFailed++;
+        driver->routeLen = 0;
+        return false;
+    }
+
+    // Finish on the zone itself, not on the last road node
+    driver->route[len++] = (Vector2){ to.x, to.z };
+    driver->routeLen = len;
+    driver->routeIndex = 0;
+    driver->noProgressTimer = 0.0f;
+    driver->reverseAttempts = 0;
+    driver->bestDist = 1e9f;
+    return true;
+}
+
+/*
+ * Description: Picks the next job and advances the current one (accept -> pick up -> deliver).
+ * Parameters:
+ * - driver: Driver state.
+ * - phone: Phone state holding the generated jobs.
+ * - player: Pointer to the Player.
+ * - map: Pointer to the GameMap.
+ * - timings: Routing timings.
+ * Returns: None.
+ */
+static void UpdateSimJobs(SimDriver *driver, PhoneState *phone, Player *player, GameMap *map, SimTimings *timings) {
+    if (driver->taskIndex == -1) {
+        for (int i = 0; i < 5; i++) {
+            if (phone->tasks[i].status != JOB_AVAILABLE) continue;
+            phone->tasks[i].status = JOB_ACCEPTED;
+            driver->taskIndex = i;
+            if (!PlanRoute(driver, map, player->position, GetDeliveryZonePos(&phone->tasks[i], map), timings)) {
+                phone->tasks[i].status = JOB_DELIVERED; // Unreachable, drop it
+                driver->taskIndex = -1;
+                continue;
+            }
+            break;
+        }
+        return;
+    }
+
+    DeliveryTask *t = &phone->tasks[driver->taskIndex];
+    Vector3 zone = GetDeliveryZonePos(t, map);
+    float dist = Vector2Distance((Vector2){ player->position.x, player->position.z }, (Vector2){ zone.x, zone.z });
+    if (dist > SIM_ARRIVE_RADIUS) return;
+
+    if (t->status == JOB_ACCEPTED) {
+        t->status = JOB_PICKED_UP;
+        if (!PlanRoute(driver, map, player->position, GetDeliveryZonePos(t, map), timings)) {
+            t->status = JOB_DELIVERED;
+            driver->taskIndex = -1;
+        }
+    } else {
+        AddMoney(player, "Sim Delivery", t->pay);
+        t->status = JOB_DELIVERED;
+        deliveriesDone++;
+        driver->taskIndex = -1;
+        driver->routeLen = 0;
+    }
+}
+
+/*
+ * Description: Simple waypoint follower. Steers toward the next route point, slows for
+ * sharp turns and backs up (eventually skipping the waypoint) when it stops making progress.
+ * Parameters:
+ * - driver: Driver state.
+ * - player: Pointer to the Player.
+ * - dt: Delta Time.
+ * Returns: The input to feed into UpdatePlayer.
+ */
+static PlayerInput DriveRoute(SimDriver *driver, Player *player, float dt) {
+    PlayerInput input = { 0 };
+    if (driver->routeLen == 0 || driver->routeIndex >= driver->routeLen) return input;
+
+    Vector2 pos = { player->position.x, player->position.z };
+    Vector2 target = driver->route[driver->routeIndex];
+    float dist = Vector2Distance(pos, target);
+
+    if (dist < SIM_WAYPOINT_RADIUS && driver->routeIndex < driver->routeLen - 1) {
+        driver->routeIndex++;
+        driver->bestDist = 1e9f;
+        driver->noProgressTimer = 0.0f;
+        driver->reverseAttempts = 0;
+        target = driver->route[driver->routeIndex];
+        dist = Vector2Distance(pos, target);
+    }
+
+    // Progress watchdog (paused while backing up)
+    if (driver->reverseTimer <= 0.0f) {
+        if (dist < driver->bestDist - 0.5f) {
+            driver->bestDist = dist;
+            driver->noProgressTimer = 0.0f;
+        } else {
+            driver->noProgressTimer += dt;
+        }
+    }
+
+    if (driver->noProgressTimer > SIM_STUCK_TIME) {
+        driver->noProgressTimer = 0.0f;
+        driver->bestDist = 1e9f;
+
+        if (++driver->reverseAttempts > SIM_MAX_REVERSES) {
+            // Hopelessly wedged: put the car on the waypoint and carry on
+            player->position = (Vector3){ target.x, player->position.y, target.y };
+            player->current_speed = 0.0f;
+            SnapPlayerState(player);
+            if (driver->routeIndex < driver->routeLen - 1) driver->routeIndex++;
+            driver->reverseAttempts = 0;
+            rescues++;
+            return input;
+        }
+        driver->reverseTimer = SIM_REVERSE_TIME;
+    }
+
+    // Heading error in degrees, same convention as UpdatePlayer (sin/cos of angle)
+    float desired = atan2f(target.x - pos.x, target.y - pos.y) * RAD2DEG;
+    float diff = fmodf(desired - player->angle + 540.0f, 360.0f) - 180.0f;
+
+    if (driver->reverseTimer > 0.0f) {
+        driver->reverseTimer -= dt;
+        input.reverse = true;
+        // Reversing swings the nose the other way
+        if (diff > 5.0f) input.right = true;
+        else if (diff < -5.0f) input.left = true;
+        return input;
+    }
+
+    if (diff > 5.0f) input.left = true;
+    else if (diff < -5.0f) input.right = true;
+
+    float wantSpeed = (fabsf(diff) > 35.0f) ? SIM_CORNER_SPEED : SIM_CRUISE_SPEED;
+    if (player->current_speed < wantSpeed) input.gas = true;
+    else if (player->current_speed > wantSpeed + 3.0f) input.reverse = true; // Brake
+
+    return input;
+}
+
+static void PrintUsage(void) {
+    printf("Usage: headless_sim [--map FILE] [--seconds N] [--dt SECONDS] [--seed N] [--threads N] [--csv FILE]\n");
+}
+
+int main(int argc, char **argv) {
+    const char *mapPath = SIM_DEFAULT_MAP;
+    const char *csvPath = NULL;
+    float seconds = SIM_DEFAULT_SECONDS;
+    float dt = SIM_DEFAULT_DT;
+    unsigned int seed = 1234;
+    int threads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--map") == 0 && hasValue) mapPath = argv[++i];
+        else if (strcmp(argv[i], "--seconds") == 0 && hasValue) seconds = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "--dt") == 0 && hasValue) dt = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && hasValue) seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--threads") == 0 && hasValue) threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--csv") == 0 && hasValue) csvPath = argv[++i];
+        else {
+            PrintUsage();
+            return (strcmp(argv[i], "--help") == 0) ? 0 : 1;
+        }
+    }
+    if (dt <= 0.0f || seconds <= 0.0f) {
+        PrintUsage();
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(seed);
+    InitThreadPool(threads);
+    SetMapHeadless(true);
+
+    // --- LOAD ---
+    double loadStart = NowMs();
+    GameMap map = LoadGameMap(mapPath);
+    double loadMs = NowMs() - loadStart;
+    if (map.nodeCount == 0) {
+        printf("HEADLESS: Map '%s' has no road nodes, aborting.\n", mapPath);
+        UnloadGameMap(&map);
+        ShutdownThreadPool();
+        return 1;
+    }
+
+    Vector3 startPos = { map.nodes[map.nodeCount > 10 ? 10 : 0].position.x, 0.5f, map.nodes[map.nodeCount > 10 ? 10 : 0].position.y };
+    Player player = InitPlayer(startPos);
+    player.tutorialFinished = true;
+
+    TrafficManager *traffic = (TrafficManager *)calloc(1, sizeof(TrafficManager));
+    InitTraffic(traffic);
+
+    PhoneState *phone = (PhoneState *)calloc(1, sizeof(PhoneState));
+    InitDeliveryApp(phone, &map);
+
+    SimDriver driver = { 0 };
+    driver.taskIndex = -1;
+
+    int steps = (int)ceilf(seconds / dt);
+    SimTimings timings[SIM_COUNT];
+    for (int s = 0; s < SIM_COUNT; s++) {
+        // Routing can search once per job slot in a single step
+        int capacity = (steps + 1) * (s == SIM_ROUTING ? 5 : 1);
+        timings[s].samples = (double *)malloc(sizeof(double) * capacity);
+        timings[s].count = 0;
+    }
+
+    FILE *csv = NULL;
+    if (csvPath) {
+        csv = fopen(csvPath, "w");
+        if (csv) fprintf(csv, "step,player_ms,traffic_ms,streaming_ms,jobs_ms,step_ms\n");
+        else printf("HEADLESS: Could not open %s for writing.\n", csvPath);
+    }
+
+    printf("HEADLESS: %s loaded in %.1f ms (%d nodes, %d edges, %d buildings). Simulating %.1f s at dt %.4f (%d steps)...\n",
+           mapPath, loadMs, map.nodeCount, map.edgeCount, map.buildingCount, seconds, dt, steps);
+
+    // --- SIMULATION LOOP ---
+    double simStart = NowMs();
+    for (int step = 0; step < steps; step++) {
+        double stepStart = NowMs();
+        double t0, t1;
+
+        UpdateSimJobs(&driver, phone, &player, &map, &timings[SIM_ROUTING]);
+        PlayerInput input = DriveRoute(&driver, &player, dt);
+        SetPlayerInputOverride(&input);
+
+        Vector3 before = player.position;
+        t0 = NowMs();
+        UpdatePlayer(&player, &map, traffic, dt);
+        t1 = NowMs();
+        timings[SIM_PLAYER].samples[timings[SIM_PLAYER].count++] = t1 - t0;
+        distanceDriven += Vector3Distance(before, player.position);
+        player.fuel = player.maxFuel; // Fuel isn't what we're measuring
+
+        t0 = NowMs();
+        UpdateTraffic(traffic, player.position, &map, dt);
+        t1 = NowMs();
+        timings[SIM_TRAFFIC].samples[timings[SIM_TRAFFIC].count++] = t1 - t0;
+
+        t0 = NowMs();
+        UpdateMapStreaming(&map, player.position);
+        t1 = NowMs();
+        timings[SIM_STREAMING].samples[timings[SIM_STREAMING].count++] = t1 - t0;
+
+        t0 = NowMs();
+        AdvanceDeliveryClock(dt);
+        UpdateDeliveryApp(phone, &player, &map, dt);
+        t1 = NowMs();
+        timings[SIM_JOBS].samples[timings[SIM_JOBS].count++] = t1 - t0;
+
+        double stepMs = NowMs() - stepStart;
+        timings[SIM_STEP].samples[timings[SIM_STEP].count++] = stepMs;
+
+        if (csv) {
+            fprintf(csv, "%d,%.4f,%.4f,%.4f,%.4f,%.4f\n", step,
+                    timings[SIM_PLAYER].samples[step], timings[SIM_TRAFFIC].samples[step],
+                    timings[SIM_STREAMING].samples[step], timings[SIM_JOBS].samples[step], stepMs);
+        }
+    }
+    double simMs = NowMs() - simStart;
+    SetPlayerInputOverride(NULL);
+    if (csv) fclose(csv);
+
+    // --- REPORT ---
+    printf("\nHEADLESS: %d steps in %.1f ms wall (%.1fx real time)\n", steps, simMs, (seconds * 1000.0) / (simMs > 0.0 ? simMs : 1.0));
+    printf("%-14s %8s %11s %9s %9s %9s %9s\n", "Subsystem", "Calls", "Total ms", "Mean ms", "P50 ms", "P99 ms", "Max ms");
+    for (int s = 0; s < SIM_COUNT; s++) {
+        SimTimings *tm = &timings[s];
+        double total = 0.0;
+        for (int i = 0; i < tm->count; i++) total += tm->samples[i];
+        qsort(tm->samples, tm->count, sizeof(double), CompareDoubles);
+        printf("%-14s %8d %11.2f %9.4f %9.4f %9.4f %9.4f\n", simNames[s], tm->count, total,
+               tm->count ? total / tm->count : 0.0,
+               Percentile(tm->samples, tm->count, 50.0), Percentile(tm->samples, tm->count, 99.0),
+               tm->count ? tm->samples[tm->count - 1] : 0.0);
+    }
+    printf("\nDeliveries: %d | Routes: %d (%d failed) | Rescues: %d | Distance: %.0f m | Money: %.2f\n",
+           deliveriesDone, routesPlanned, routesFailed, rescues, distanceDriven, player.money);
+
+    // --- CLEANUP ---
+    for (int s = 0; s < SIM_COUNT; s++) free(timings[s].samples);
+    UnloadTraffic(traffic);
+    free(traffic);
+    free(phone);
+    UnloadGameMap(&map);
+    ShutdownThreadPool();
+    return 0;
+}
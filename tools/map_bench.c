@@ -0,0 +1,354 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Game Title: Delivery Game
+ * Authors: Lucas Liço, Michail Michailidis
+ * Copyright (c) 2025-2026
+ *
+ * License: zlib/libpng
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software.
+ *
+ * Full license terms: see the LICENSE file.
+ * -----------------------------------------------------------------------------
+ */
+
+// --- MAP MICRO-BENCHMARKS ---
+// Times the map.c hot paths in isolation on every shipped map and prints median/p99
+// tables. Runs headless (no window, no GPU uploads), so sector bake numbers are the
+// CPU stages only.
+//
+// Build: premake target "map_bench" (see build/premake5.lua). Run from the repo root:
+//   map_bench [--maps level1,real_city] [--iterations 5] [--pairs 200] [--queries 4096] [--sectors 24] [--seed 1234]
+
+#include "raylib.h"
+#include "raymath.h"
+#include "map.h"
+#include "maps_app.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// --- CONFIGURATION ---
+#define BENCH_MAP_DIR "resources/Maps/"
+#define BENCH_MAX_MAPS 16
+#define BENCH_QUERY_BATCH 64        // Cheap queries are timed in batches, reported per call
+#define BENCH_PATH_LEN 2048
+
+static const char *defaultMaps[] = {
+    "level1", "real_city", "smaller_city", "small_city", "expanded_city", "whole_city"
+};
+
+typedef enum {
+    BENCH_PARSE = 0,
+    BENCH_MANIFESTS,
+    BENCH_COLLISION_GRID,
+    BENCH_MAP_GRAPH,
+    BENCH_LOCATION_PLACEMENTS,
+    BENCH_FIND_PATH,
+    BENCH_CLOSEST_NODE,
+    BENCH_MAP_COLLISION,
+    BENCH_SWEEP_COLLISION,
+    BENCH_SNAP_TO_ROAD,
+    BENCH_TRIANGULATE,
+    BENCH_SECTOR_SETUP,
+    BENCH_SECTOR_BUILDINGS,
+    BENCH_SECTOR_ROADS,
+    BENCH_SECTOR_VEGETATION,
+    BENCH_SECTOR_UPLOAD,
+    BENCH_COUNT
+} BenchId;
+
+static const char *benchNames[BENCH_COUNT] = {
+    "ParseGameMap", "BuildSectorManifests", "BuildCollisionGrid", "BuildMapGraph", "BuildLocationPlacements",
+    "FindPath", "GetClosestNode", "CheckMapCollision", "SweepMapCollision", "SnapToRoad", "TriangulatePolygon",
+    "Sector 0: Setup", "Sector 1: Buildings", "Sector 2: Roads", "Sector 3: Vegetation", "Sector 4: Upload*"
+};
+
+// Growable sample list (microseconds)
+typedef struct {
+    double *samples;
+    int count;
+    int capacity;
+} BenchSeries;
+
+typedef struct {
+    const char *name;
+    bool loaded;
+    double median[BENCH_COUNT];
+    double p99[BENCH_COUNT];
+    int samples[BENCH_COUNT];
+} BenchMapResult;
+
+static BenchSeries series[BENCH_COUNT];
+
+static void AddSample(BenchId id, double us) {
+    BenchSeries *s = &series[id];
+    if (s->count >= s->capacity) {
+        s->capacity = (s->capacity == 0) ? 256 : s->capacity * 2;
+        s->samples = (double *)realloc(s->samples, s->capacity * sizeof(double));
+    }
+    s->samples[s->count++] = us;
+}
+
+/*
+ * Description: Random point inside the road network's bounding box.
+ * Parameters:
+ * - minP, maxP: Bounds.
+ * Returns: The point.
+ */
+static Vector2 RandomPoint(Vector2 minP, Vector2 maxP) {
+    float u = (float)GetRandomValue(0, 10000) / 10000.0f;
+    float v = (float)GetRandomValue(0, 10000) / 10000.0f;
+    return (Vector2){ minP.x + (maxP.x - minP.x) * u, minP.y + (maxP.y - minP.y) * v };
+}
+
+/*
+ * Description: Loads one sector through the streaming pipeline and records the time spent in each stage.
+ * Parameters:
+ * - map: Pointer to the GameMap.
+ * - x, y: Sector grid coordinates.
+ * Returns: None.
+ */
+static void BenchSectorBake(GameMap *map, int x, int y) {
+    double stageUs[5] = { 0 };
+
+    UnloadSectorChunk(x, y);
+    BeginSectorLoad(x, y);
+
+    bool more = true;
+    while (more) {
+        int stage = GetSectorLoadStage(x, y);
+        double t0 = NowUs();
+        more = ProcessSectorLoadStep(map);
+        if (stage >= 0 && stage < 5) stageUs[stage] += NowUs() - t0;
+    }
+
+    for (int s = 0; s < 5; s++) AddSample(BENCH_SECTOR_SETUP + s, stageUs[s]);
+    UnloadSectorChunk(x, y);
+}
+
+/*
+ * Description: Runs every benchmark on one map.
+ * Parameters:
+ * - path: Map file path.
+ * - iterations: Repetitions for the whole-map stages.
+ * - pairs: Number of FindPath origin/destination pairs.
+ * - queries: Number of point queries (closest node, collision, snap).
+ * - sectorCount: Number of distinct sectors to bake.
+ * - seed: RNG seed (same workload on every run).
+ * Returns: None.
+ */
+static void RunMapBenchmarks(const char *path, int iterations, int pairs, int queries, int sectorCount, unsigned int seed) {
+    // --- PARSING (file -> arrays, nothing else) ---
+    for (int it = 0; it < iterations; it++) {
+        GameMap parsed = { 0 };
+        double t0 = NowUs();
+        ParseGameMap(path, &parsed);
+        AddSample(BENCH_PARSE, NowUs() - t0);
+        UnloadGameMap(&parsed);
+    }
+
+    SetRandomSeed(seed);
+    GameMap map = LoadGameMap(path);
+
+    // --- WHOLE-MAP BUILD STAGES ---
+    for (int it = 0; it < iterations; it++) {
+        ClearSectorManifests();
+        double t0 = NowUs();
+        BuildSectorManifests(&map);
+        AddSample(BENCH_MANIFESTS, NowUs() - t0);
+
+        ClearCollisionGrid();
+        t0 = NowUs();
+        BuildCollisionGrid(&map);
+        AddSample(BENCH_COLLISION_GRID, NowUs() - t0);
+
+        t0 = NowUs();
+        BuildMapGraph(&map);
+        AddSample(BENCH_MAP_GRAPH, NowUs() - t0);
+
+        // Puts the location entries back into the rebuilt manifests, as the real load does
+        t0 = NowUs();
+        BuildLocationPlacements(&map);
+        AddSample(BENCH_LOCATION_PLACEMENTS, NowUs() - t0);
+    }
+
+    if (map.nodeCount < 2) {
+        UnloadGameMap(&map);
+        return;
+    }
+
+    Vector2 minP = map.nodes[0].position;
+    Vector2 maxP = map.nodes[0].position;
+    for (int i = 1; i < map.nodeCount; i++) {
+        Vector2 p = map.nodes[i].position;
+        minP = (Vector2){ fminf(minP.x, p.x), fminf(minP.y, p.y) };
+        maxP = (Vector2){ fmaxf(maxP.x, p.x), fmaxf(maxP.y, p.y) };
+    }
+
+    // --- FINDPATH (random node pairs) ---
+    Vector2 *path2 = (Vector2 *)malloc(sizeof(Vector2) * BENCH_PATH_LEN);
+    for (int i = 0; i < pairs; i++) {
+        Vector2 a = map.nodes[GetRandomValue(0, map.nodeCount - 1)].position;
+        Vector2 b = map.nodes[GetRandomValue(0, map.nodeCount - 1)].position;
+        double t0 = NowUs();
+        FindPath(&map, a, b, path2, BENCH_PATH_LEN);
+        AddSample(BENCH_FIND_PATH, NowUs() - t0);
+    }
+    free(path2);
+
+    // --- POINT QUERIES ---
+    Vector2 *points = (Vector2 *)malloc(sizeof(Vector2) * queries);
+    for (int i = 0; i < queries; i++) points[i] = RandomPoint(minP, maxP);
+
+    volatile int sink = 0; // Keeps the calls from being optimized away
+    for (int i = 0; i + BENCH_QUERY_BATCH <= queries; i += BENCH_QUERY_BATCH) {
+        double t0 = NowUs();
+        for (int k = 0; k < BENCH_QUERY_BATCH; k++) sink += GetClosestNode(&map, points[i + k]);
+        AddSample(BENCH_CLOSEST_NODE, (NowUs() - t0) / BENCH_QUERY_BATCH);
+
+        t0 = NowUs();
+        for (int k = 0; k < BENCH_QUERY_BATCH; k++) sink += CheckMapCollision(&map, points[i + k].x, points[i + k].y, 1.0f, false);
+        AddSample(BENCH_MAP_COLLISION, (NowUs() - t0) / BENCH_QUERY_BATCH);
+
+        // One 120 Hz physics step at ~40 m/s in a random direction
+        t0 = NowUs();
+        for (int k = 0; k < BENCH_QUERY_BATCH; k++) {
+            float a = (float)(k * 0.618f * 2.0f * PI);
+            Vector2 move = { cosf(a) * 0.35f, sinf(a) * 0.35f };
+            sink += SweepMapCollision(&map, points[i + k], move, 1.6f, false).hit;
+        }
+        AddSample(BENCH_SWEEP_COLLISION, (NowUs() - t0) / BENCH_QUERY_BATCH);
+    }
+
+    // SnapToRoad scans every edge, so one call per sample is plenty
+    int snapCount = (queries < 512) ? queries : 512;
+    for (int i = 0; i < snapCount; i++) {
+        double t0 = NowUs();
+        Vector2 snapped = SnapToRoad(&map, points[i], 30.0f);
+        AddSample(BENCH_SNAP_TO_ROAD, NowUs() - t0);
+        sink += (int)snapped.x;
+    }
+    free(points);
+    (void)sink;
+
+    // --- TRIANGULATION (every building footprint) ---
+    static int triIndices[MAX_BUILDING_POINTS * 3];
+    for (int i = 0; i < map.buildingCount; i++) {
+        Building *b = &map.buildings[i];
+        double t0 = NowUs();
+        TriangulatePolygon(b->footprint, b->pointCount, triIndices);
+        AddSample(BENCH_TRIANGULATE, NowUs() - t0);
+    }
+
+    // --- SECTOR BAKES (sectors picked from random buildings) ---
+    int *picked = (int *)malloc(sizeof(int) * (sectorCount > 0 ? sectorCount : 1));
+    int pickedCount = 0;
+    for (int attempt = 0; attempt < sectorCount * 20 && pickedCount < sectorCount && map.buildingCount > 0; attempt++) {
+        Vector2 p = map.buildings[GetRandomValue(0, map.buildingCount - 1)].footprint[0];
+        int sx, sy;
+        if (!GetSectorAt(p, &sx, &sy)) continue;
+
+        int key = (sy << 16) | sx;
+        bool seen = false;
+        for (int k = 0; k < pickedCount; k++) if (picked[k] == key) { seen = true; break; }
+        if (!seen) picked[pickedCount++] = key;
+    }
+    for (int it = 0; it < iterations; it++) {
+        for (int k = 0; k < pickedCount; k++) {
+            BenchSectorBake(&map, picked[k] & 0xFFFF, picked[k] >> 16);
+        }
+    }
+    free(picked);
+
+    UnloadGameMap(&map);
+}
+
+static void PrintUsage(void) {
+    printf("Usage: map_bench [--maps a,b,...] [--iterations N] [--pairs N] [--queries N] [--sectors N] [--seed N]\n");
+}
+
+int main(int argc, char **argv) {
+    const char *mapNames[BENCH_MAX_MAPS];
+    int mapCount = 0;
+    static char mapList[512];
+    int iterations = 5;
+    int pairs = 200;
+    int queries = 4096;
+    int sectorCount = 24;
+    unsigned int seed = 1234;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--maps") == 0 && hasValue) {
+            strncpy(mapList, argv[++i], sizeof(mapList) - 1);
+            for (char *tok = strtok(mapList, ","); tok && mapCount < BENCH_MAX_MAPS; tok = strtok(NULL, ",")) {
+                mapNames[mapCount++] = tok;
+            }
+        }
+        else if (strcmp(argv[i], "--iterations") == 0 && hasValue) iterations = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--pairs") == 0 && hasValue) pairs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--queries") == 0 && hasValue) queries = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--sectors") == 0 && hasValue) sectorCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && hasValue) seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else {
+            PrintUsage();
+            return (strcmp(argv[i], "--help") == 0) ? 0 : 1;
+        }
+    }
+    if (mapCount == 0) {
+        mapCount = (int)(sizeof(defaultMaps) / sizeof(defaultMaps[0]));
+        for (int i = 0; i < mapCount; i++) mapNames[i] = defaultMaps[i];
+    }
+    if (iterations < 1) iterations = 1;
+    if (queries < BENCH_QUERY_BATCH) queries = BENCH_QUERY_BATCH;
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetMapHeadless(true);
+
+    BenchMapResult results[BENCH_MAX_MAPS] = { 0 };
+
+    for (int m = 0; m < mapCount; m++) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s%s.map", BENCH_MAP_DIR, mapNames[m]);
+        results[m].name = mapNames[m];
+
+        if (!FileExists(path)) {
+            printf("BENCH: %s not found, skipping.\n", path);
+            continue;
+        }
+
+        for (int b = 0; b < BENCH_COUNT; b++) series[b].count = 0;
+        RunMapBenchmarks(path, iterations, pairs, queries, sectorCount, seed);
+        results[m].loaded = true;
+
+        printf("\n=== %s ===\n", mapNames[m]);
+        printf("%-22s %8s %12s %12s\n", "Function", "Samples", "Median us", "P99 us");
+        for (int b = 0; b < BENCH_COUNT; b++) {
+            BenchSeries *s = &series[b];
+            qsort(s->samples, s->count, sizeof(double), CompareDoubles);
+            results[m].samples[b] = s->count;
+            results[m].median[b] = Percentile(s->samples, s->count, 50.0);
+            results[m].p99[b] = Percentile(s->samples, s->count, 99.0);
+            printf("%-22s %8d %12.2f %12.2f\n", benchNames[b], s->count, results[m].median[b], results[m].p99[b]);
+        }
+    }
+
+    // --- SUMMARY (medians, one column per map) ---
+    printf("\n=== Median us per call ===\n%-22s", "Function");
+    for (int m = 0; m < mapCount; m++) if (results[m].loaded) printf(" %14.14s", results[m].name);
+    printf("\n");
+    for (int b = 0; b < BENCH_COUNT; b++) {
+        printf("%-22s", benchNames[b]);
+        for (int m = 0; m < mapCount; m++) if (results[m].loaded) printf(" %14.2f", results[m].median[b]);
+        printf("\n");
+    }
+    printf("* Headless: no GPU upload, and prop models are not loaded (see SetMapHeadless).\n");
+
+    for (int b = 0; b < BENCH_COUNT; b++) free(series[b].samples);
+    return 0;
+}